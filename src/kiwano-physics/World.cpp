@@ -67,8 +67,8 @@ public:
         Contact contact;
         contact.SetB2Contact(b2contact);
 
-        ContactBeginEventPtr evt = new ContactBeginEvent(contact);
-        world_->DispatchEvent(evt.get());
+        ContactBeginEvent evt(contact);
+        world_->DispatchEvent(&evt);
     }
 
     void EndContact(b2Contact* b2contact) override
@@ -76,8 +76,8 @@ public:
         Contact contact;
         contact.SetB2Contact(b2contact);
 
-        ContactEndEventPtr evt = new ContactEndEvent(contact);
-        world_->DispatchEvent(evt.get());
+        ContactEndEvent evt(contact);
+        world_->DispatchEvent(&evt);
     }
 
     void PreSolve(b2Contact* contact, const b2Manifold* oldManifold) override
@@ -20,7 +20,9 @@
 
 #include <kiwano/2d/Actor.h>
 #include <kiwano/2d/Stage.h>
+#include <kiwano/2d/action/TweenSystem.h>
 #include <kiwano/core/Logger.h>
+#include <kiwano/core/Profiler.h>
 #include <kiwano/render/Renderer.h>
 
 namespace kiwano
@@ -31,6 +33,44 @@ namespace
 float default_anchor_x = 0.f;
 float default_anchor_y = 0.f;
 
+// the occlusion pass is O(actors * occluders), keep the occluder list short
+const size_t max_occluders_count = 16;
+
+class ProfilingGuard
+{
+public:
+    ProfilingGuard(Profiler::Phase phase)
+        : profiler_(nullptr)
+        , scope_(nullptr)
+        , phase_(phase)
+    {
+    }
+
+    ~ProfilingGuard()
+    {
+        if (profiler_)
+            profiler_->EndNode(scope_, phase_);
+    }
+
+    void Begin(Profiler& profiler, SceneStatistics* scope)
+    {
+        profiler_ = &profiler;
+        scope_    = scope;
+        profiler_->BeginNode(scope_, phase_);
+    }
+
+private:
+    Profiler*        profiler_;
+    SceneStatistics* scope_;
+    Profiler::Phase  phase_;
+};
+
+inline bool ContainsRect(Rect const& outer, Rect const& inner)
+{
+    return inner.left_top.x >= outer.left_top.x && inner.left_top.y >= outer.left_top.y
+           && inner.right_bottom.x <= outer.right_bottom.x && inner.right_bottom.y <= outer.right_bottom.y;
+}
+
 }  // namespace
 
 void Actor::SetDefaultAnchor(float anchor_x, float anchor_y)
@@ -52,12 +92,17 @@ Actor::Actor()
     , hover_(false)
     , pressed_(false)
     , responsible_(false)
+    , is_static_(false)
+    , cache_expired_(true)
+    , tweened_(false)
     , dirty_visibility_(true)
+    , dirty_damage_(true)
     , dirty_transform_(false)
     , dirty_transform_inverse_(false)
     , cascade_opacity_(false)
     , show_border_(false)
     , is_fast_transform_(true)
+    , occluded_(false)
     , parent_(nullptr)
     , stage_(nullptr)
     , hash_name_(0)
@@ -68,12 +113,24 @@ Actor::Actor()
 {
 }
 
-Actor::~Actor() {}
+Actor::~Actor()
+{
+    // TweenSystem holds raw pointers of actors
+    if (tweened_)
+        TweenSystem::Instance().RemoveTweens(this);
+}
 
 void Actor::Update(Duration dt)
 {
+    ProfilingGuard guard(Profiler::Phase::Update);
+
+    Profiler& profiler = Profiler::Instance();
+    if (profiler.IsEnabled())
+        guard.Begin(profiler, GetStatisticsScope(profiler, Profiler::Phase::Update));
+
     UpdateActions(this, dt);
     UpdateTimers(dt);
+    UpdateTasks(this, dt);
 
     if (!update_pausing_)
     {
@@ -99,15 +156,29 @@ void Actor::Render(RenderContext& ctx)
     if (!visible_)
         return;
 
+    ProfilingGuard guard(Profiler::Phase::Render);
+
+    Profiler& profiler = Profiler::Instance();
+    if (profiler.IsEnabled())
+        guard.Begin(profiler, GetStatisticsScope(profiler, Profiler::Phase::Render));
+
     UpdateTransform();
 
+    if (is_static_)
+    {
+        RenderStaticCache(ctx);
+    }
+    else
+    {
+        RenderSelfAndChildren(ctx);
+    }
+}
+
+void Actor::RenderSelfAndChildren(RenderContext& ctx)
+{
     if (children_.empty())
     {
-        if (CheckVisibility(ctx))
-        {
-            PrepareToRender(ctx);
-            OnRender(ctx);
-        }
+        RenderSelf(ctx);
     }
     else
     {
@@ -122,11 +193,7 @@ void Actor::Render(RenderContext& ctx)
             child = child->next_item().get();
         }
 
-        if (CheckVisibility(ctx))
-        {
-            PrepareToRender(ctx);
-            OnRender(ctx);
-        }
+        RenderSelf(ctx);
 
         while (child)
         {
@@ -136,12 +203,298 @@ void Actor::Render(RenderContext& ctx)
     }
 }
 
+void Actor::RenderSelf(RenderContext& ctx)
+{
+    if (occluded_)
+    {
+        Profiler& profiler = Profiler::Instance();
+        if (profiler.IsEnabled())
+            profiler.IncreaseCulledActors(1);
+        return;
+    }
+
+    if (CheckVisibility(ctx))
+    {
+        PrepareToRender(ctx);
+        OnRender(ctx);
+        ctx.IncreaseDrawnActorsCount();
+    }
+}
+
+SceneStatistics* Actor::GetStatisticsScope(Profiler& profiler, Profiler::Phase phase)
+{
+    if (stage_ == this)
+    {
+        Stage* stage = static_cast<Stage*>(this);
+        if (phase == Profiler::Phase::Update)
+        {
+            // a new frame begins
+            stage->last_stats_ = stage->stats_;
+            stage->stats_.Reset();
+        }
+        return &stage->stats_;
+    }
+    return profiler.FindTracked(hash_name_);
+}
+
 void Actor::PrepareToRender(RenderContext& ctx)
 {
     ctx.SetTransform(transform_matrix_);
     ctx.SetBrushOpacity(GetDisplayedOpacity());
 }
 
+void Actor::UpdateOcclusion(Vector<Rect>& occluders, RenderContext& ctx)
+{
+    if (!visible_ || is_static_)
+        return;
+
+    UpdateTransform();
+
+    occluded_ = false;
+
+    // children those are greater than or equal to 0 in Z-Order are in front of this actor
+    Actor* child = children_.last_item().get();
+    while (child)
+    {
+        if (child->GetZOrder() < 0)
+            break;
+
+        child->UpdateOcclusion(occluders, ctx);
+        child = child->prev_item().get();
+    }
+
+    if (!size_.IsOrigin())
+    {
+        const Rect bounds = transform_matrix_.Transform(GetBounds());
+        for (const auto& occluder : occluders)
+        {
+            if (ContainsRect(occluder, bounds))
+            {
+                occluded_ = true;
+                ctx.IncreaseCulledActorsCount();
+                break;
+            }
+        }
+
+        if (!occluded_ && occluders.size() < max_occluders_count && displayed_opacity_ >= 1.f
+            && transform_matrix_._12 == 0.f && transform_matrix_._21 == 0.f)
+        {
+            const Rect opaque_bounds = GetOpaqueBounds();
+            if (!opaque_bounds.IsEmpty())
+            {
+                occluders.push_back(transform_matrix_.Transform(opaque_bounds));
+            }
+        }
+    }
+
+    while (child)
+    {
+        child->UpdateOcclusion(occluders, ctx);
+        child = child->prev_item().get();
+    }
+}
+
+void Actor::RenderStaticCache(RenderContext& ctx)
+{
+    const bool cache_valid = !cache_expired_ && (cache_bounds_.IsEmpty() || (cache_ctx_ && cache_ctx_->IsValid()));
+    if (cache_valid)
+    {
+        ctx.IncreaseStaticCacheHitsCount();
+    }
+    else
+    {
+        ctx.IncreaseStaticCacheMissesCount();
+
+        if (!transform_matrix_.IsInvertible())
+            return;
+
+        // record the subtree in local space, so that moving this actor does not expire the cache
+        const Matrix3x2 to_local = transform_matrix_.Invert();
+
+        Rect bounds;
+        ComputeSubtreeBounds(to_local, bounds);
+        bounds = Rect{ std::floor(bounds.left_top.x), std::floor(bounds.left_top.y), std::ceil(bounds.right_bottom.x),
+                       std::ceil(bounds.right_bottom.y) };
+
+        if (!bounds.IsEmpty())
+        {
+            const Size cache_size = bounds.GetSize();
+            if (!cache_ctx_ || !cache_ctx_->IsValid() || cache_bounds_.GetSize() != cache_size)
+            {
+                cache_ctx_.reset();
+                Renderer::Instance().CreateTextureRenderTarget(cache_ctx_, &cache_size);
+
+                cache_texture_ = new Texture;
+                cache_ctx_->GetOutput(*cache_texture_);
+            }
+
+            const Matrix3x2 cache_transform = to_local * Matrix3x2::Translation(-bounds.left_top);
+
+            // Actors drawn into the cache are counted by the output context
+            cache_ctx_->SetCollectingStatus(ctx.IsCollectingStatus());
+            cache_ctx_->BeginDraw();
+            cache_ctx_->Clear(Color::Transparent);
+            cache_ctx_->SetGlobalTransform(&cache_transform);
+            RenderSelfAndChildren(*cache_ctx_);
+            cache_ctx_->EndDraw();
+            ctx.MergeStatus(cache_ctx_->GetStatus());
+        }
+
+        cache_bounds_  = bounds;
+        cache_expired_ = false;
+    }
+
+    if (cache_texture_ && !cache_bounds_.IsEmpty() && ctx.CheckVisibility(cache_bounds_, transform_matrix_))
+    {
+        ctx.SetTransform(transform_matrix_);
+        ctx.SetBrushOpacity(1.f);
+        ctx.DrawTexture(*cache_texture_, nullptr, &cache_bounds_);
+    }
+}
+
+void Actor::ComputeSubtreeBounds(Matrix3x2 const& to_local, Rect& bounds) const
+{
+    if (!visible_)
+        return;
+
+    UpdateTransform();
+
+    // visibility was checked against another render context
+    dirty_visibility_ = true;
+
+    if (!size_.IsOrigin())
+    {
+        const Rect local_bounds = Matrix3x2(transform_matrix_ * to_local).Transform(GetDamageBounds());
+        if (bounds.IsEmpty())
+        {
+            bounds = local_bounds;
+        }
+        else
+        {
+            bounds.left_top.x     = std::min(bounds.left_top.x, local_bounds.left_top.x);
+            bounds.left_top.y     = std::min(bounds.left_top.y, local_bounds.left_top.y);
+            bounds.right_bottom.x = std::max(bounds.right_bottom.x, local_bounds.right_bottom.x);
+            bounds.right_bottom.y = std::max(bounds.right_bottom.y, local_bounds.right_bottom.y);
+        }
+    }
+
+    for (auto child = children_.first_item().get(); child; child = child->next_item().get())
+    {
+        child->ComputeSubtreeBounds(to_local, bounds);
+    }
+}
+
+void Actor::ExpireStaticCache()
+{
+    for (Actor* actor = this; actor; actor = actor->parent_)
+    {
+        if (actor->is_static_)
+            actor->cache_expired_ = true;
+    }
+}
+
+void Actor::Invalidate()
+{
+    dirty_damage_ = true;
+    ExpireStaticCache();
+}
+
+size_t Actor::ReleaseResources()
+{
+    size_t released = 0;
+    if (cache_texture_)
+    {
+        auto pixels = cache_texture_->GetSizeInPixels();
+        released    = size_t(pixels.x) * pixels.y * 4;
+    }
+
+    cache_ctx_.reset();
+    cache_texture_.reset();
+    cache_expired_ = true;
+    return released;
+}
+
+void Actor::SetStatic(bool enable)
+{
+    if (is_static_ == enable)
+        return;
+
+    is_static_ = enable;
+
+    // expires this cache and any static ancestor's, and marks damage
+    Invalidate();
+
+    // the occlusion pass does not step into static actors
+    ResetOcclusion();
+
+    if (!is_static_)
+    {
+        cache_ctx_.reset();
+        cache_texture_.reset();
+        cache_bounds_ = Rect{};
+    }
+}
+
+void Actor::ResetOcclusion()
+{
+    occluded_ = false;
+    for (Actor* child = children_.first_item().get(); child; child = child->next_item().get())
+    {
+        child->ResetOcclusion();
+    }
+}
+
+void Actor::CollectDamage(DamageRegion& region)
+{
+    if (!visible_)
+    {
+        DiscardDamage(region);
+        return;
+    }
+
+    UpdateTransform();
+
+    if (dirty_damage_)
+    {
+        dirty_damage_ = false;
+
+        if (!damage_bounds_.IsEmpty())
+        {
+            region.Add(damage_bounds_);
+        }
+
+        if (size_.IsOrigin())
+        {
+            damage_bounds_ = Rect{};
+        }
+        else
+        {
+            damage_bounds_ = transform_matrix_.Transform(GetDamageBounds());
+            region.Add(damage_bounds_);
+        }
+    }
+
+    for (Actor* child = children_.first_item().get(); child; child = child->next_item().get())
+    {
+        child->CollectDamage(region);
+    }
+}
+
+void Actor::DiscardDamage(DamageRegion& region)
+{
+    dirty_damage_ = true;
+    if (!damage_bounds_.IsEmpty())
+    {
+        region.Add(damage_bounds_);
+        damage_bounds_ = Rect{};
+    }
+
+    for (Actor* child = children_.first_item().get(); child; child = child->next_item().get())
+    {
+        child->DiscardDamage(region);
+    }
+}
+
 void Actor::RenderBorder(RenderContext& ctx)
 {
     if (show_border_ && !size_.IsOrigin())
@@ -186,6 +539,12 @@ bool Actor::DispatchEvent(Event* evt)
     if (!visible_)
         return true;
 
+    ProfilingGuard guard(Profiler::Phase::Event);
+
+    Profiler& profiler = Profiler::Instance();
+    if (profiler.IsEnabled())
+        guard.Begin(profiler, GetStatisticsScope(profiler, Profiler::Phase::Event));
+
     // Dispatch to children those are greater than 0 in Z-Order
     Actor* child = children_.last_item().get();
     while (child)
@@ -220,24 +579,24 @@ void Actor::HandleEvent(Event* evt)
     {
         if (evt->IsType<MouseMoveEvent>())
         {
-            auto mouse_evt = dynamic_cast<MouseMoveEvent*>(evt);
+            auto mouse_evt = evt->SafeCast<MouseMoveEvent>();
             bool contains  = ContainsPoint(mouse_evt->pos);
             if (!hover_ && contains)
             {
                 hover_ = true;
 
-                MouseHoverEventPtr hover = new MouseHoverEvent;
-                hover->pos               = mouse_evt->pos;
-                EventDispatcher::DispatchEvent(hover.get());
+                MouseHoverEvent hover;
+                hover.pos = mouse_evt->pos;
+                EventDispatcher::DispatchEvent(&hover);
             }
             else if (hover_ && !contains)
             {
                 hover_   = false;
                 pressed_ = false;
 
-                MouseOutEventPtr out = new MouseOutEvent;
-                out->pos             = mouse_evt->pos;
-                EventDispatcher::DispatchEvent(out.get());
+                MouseOutEvent out;
+                out.pos = mouse_evt->pos;
+                EventDispatcher::DispatchEvent(&out);
             }
         }
 
@@ -250,12 +609,12 @@ void Actor::HandleEvent(Event* evt)
         {
             pressed_ = false;
 
-            auto mouse_up_evt = dynamic_cast<MouseUpEvent*>(evt);
+            auto mouse_up_evt = evt->SafeCast<MouseUpEvent>();
 
-            MouseClickEventPtr click = new MouseClickEvent;
-            click->pos               = mouse_up_evt->pos;
-            click->button            = mouse_up_evt->button;
-            EventDispatcher::DispatchEvent(click.get());
+            MouseClickEvent click;
+            click.pos    = mouse_up_evt->pos;
+            click.button = mouse_up_evt->button;
+            EventDispatcher::DispatchEvent(&click);
         }
     }
 }
@@ -285,6 +644,7 @@ void Actor::UpdateTransform() const
     dirty_transform_         = false;
     dirty_transform_inverse_ = true;
     dirty_visibility_        = true;
+    dirty_damage_            = true;
 
     if (is_fast_transform_)
     {
@@ -319,6 +679,8 @@ void Actor::UpdateOpacity()
         displayed_opacity_ = opacity_;
     }
 
+    Invalidate();
+
     for (Actor* child = children_.first_item().get(); child; child = child->next_item().get())
     {
         child->UpdateOpacity();
@@ -366,6 +728,10 @@ void Actor::Reorder()
         {
             parent_->children_.push_front(me);
         }
+
+        // 绘制顺序改变，重叠区域需要重绘
+        dirty_damage_ = true;
+        parent_->Invalidate();
     }
 }
 
@@ -403,6 +769,9 @@ void Actor::SetAnchor(Vec2 const& anchor)
 
     anchor_          = anchor;
     dirty_transform_ = true;
+
+    if (parent_)
+        parent_->ExpireStaticCache();
 }
 
 void Actor::SetWidth(float width)
@@ -422,6 +791,9 @@ void Actor::SetSize(Size const& size)
 
     size_            = size;
     dirty_transform_ = true;
+
+    if (parent_)
+        parent_->ExpireStaticCache();
 }
 
 void Actor::SetTransform(Transform const& transform)
@@ -429,11 +801,18 @@ void Actor::SetTransform(Transform const& transform)
     transform_         = transform;
     dirty_transform_   = true;
     is_fast_transform_ = false;
+
+    if (parent_)
+        parent_->ExpireStaticCache();
 }
 
 void Actor::SetVisible(bool val)
 {
-    visible_ = val;
+    visible_      = val;
+    dirty_damage_ = true;
+
+    if (parent_)
+        parent_->ExpireStaticCache();
 }
 
 void Actor::SetName(String const& name)
@@ -452,6 +831,9 @@ void Actor::SetPosition(const Point& pos)
 
     transform_.position = pos;
     dirty_transform_    = true;
+
+    if (parent_)
+        parent_->ExpireStaticCache();
 }
 
 void Actor::SetPositionX(float x)
@@ -477,6 +859,9 @@ void Actor::SetScale(Vec2 const& scale)
     transform_.scale   = scale;
     dirty_transform_   = true;
     is_fast_transform_ = false;
+
+    if (parent_)
+        parent_->ExpireStaticCache();
 }
 
 void Actor::SetSkew(Vec2 const& skew)
@@ -487,6 +872,9 @@ void Actor::SetSkew(Vec2 const& skew)
     transform_.skew    = skew;
     dirty_transform_   = true;
     is_fast_transform_ = false;
+
+    if (parent_)
+        parent_->ExpireStaticCache();
 }
 
 void Actor::SetRotation(float angle)
@@ -497,6 +885,9 @@ void Actor::SetRotation(float angle)
     transform_.rotation = angle;
     dirty_transform_    = true;
     is_fast_transform_  = false;
+
+    if (parent_)
+        parent_->ExpireStaticCache();
 }
 
 void Actor::AddChild(Actor* child, int zorder)
@@ -528,12 +919,14 @@ void Actor::AddChild(Actor* child, int zorder)
         child->z_order_         = zorder;
         child->Reorder();
         child->UpdateOpacity();
+
+        ExpireStaticCache();
     }
 }
 
 void Actor::AddChild(ActorPtr child, int zorder)
 {
-    AddChild(child.get());
+    AddChild(child.get(), zorder);
 }
 
 void Actor::AddChildren(Vector<ActorPtr> const& children)
@@ -615,10 +1008,20 @@ void Actor::RemoveChild(Actor* child)
 
     if (child)
     {
+        if (stage_)
+        {
+            if (stage_->IsDamageTrackingEnabled())
+                child->DiscardDamage(stage_->damage_);
+            if (stage_->IsOcclusionCullingEnabled())
+                child->ResetOcclusion();
+        }
+
         child->parent_ = nullptr;
         if (child->stage_)
             child->SetStage(nullptr);
         children_.remove(ActorPtr(child));
+
+        ExpireStaticCache();
     }
 }
 
@@ -645,7 +1048,18 @@ void Actor::RemoveChildren(String const& child_name)
 
 void Actor::RemoveAllChildren()
 {
+    if (stage_)
+    {
+        for (Actor* child = children_.first_item().get(); child; child = child->next_item().get())
+        {
+            if (stage_->IsDamageTrackingEnabled())
+                child->DiscardDamage(stage_->damage_);
+            if (stage_->IsOcclusionCullingEnabled())
+                child->ResetOcclusion();
+        }
+    }
     children_.clear();
+    ExpireStaticCache();
 }
 
 void Actor::SetResponsible(bool enable)
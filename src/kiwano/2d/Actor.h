@@ -22,9 +22,12 @@
 #include <kiwano/2d/action/ActionManager.h>
 #include <kiwano/core/EventDispatcher.h>
 #include <kiwano/core/ObjectBase.h>
+#include <kiwano/core/Profiler.h>
+#include <kiwano/core/TaskManager.h>
 #include <kiwano/core/Time.h>
 #include <kiwano/core/TimerManager.h>
 #include <kiwano/math/Math.h>
+#include <kiwano/render/DamageRegion.h>
 
 namespace kiwano
 {
@@ -33,6 +36,8 @@ class Director;
 class RenderContext;
 
 KGE_DECLARE_SMART_PTR(Actor);
+KGE_DECLARE_SMART_PTR(Texture);
+KGE_DECLARE_SMART_PTR(TextureRenderContext);
 
 /**
  * \~chinese
@@ -55,10 +60,12 @@ class KGE_API Actor
     , public TimerManager
     , public ActionManager
     , public EventDispatcher
+    , public TaskManager
     , protected IntrusiveListItem<ActorPtr>
 {
     friend class Director;
     friend class Transition;
+    friend class TweenSystem;
     friend IntrusiveList<ActorPtr>;
 
 public:
@@ -103,6 +110,10 @@ public:
     /// @brief 是否启用级联透明度
     bool IsCascadeOpacityEnabled() const;
 
+    /// \~chinese
+    /// @brief 是否为静态角色
+    bool IsStatic() const;
+
     /// \~chinese
     /// @brief 获取名称的 Hash 值
     size_t GetHashName() const;
@@ -215,6 +226,11 @@ public:
     /// @brief 获取外切包围盒
     virtual Rect GetBoundingBox() const;
 
+    /// \~chinese
+    /// @brief 获取不透明区域
+    /// @details 被不透明区域完全遮挡的角色将在启用遮挡剔除时跳过渲染，返回空矩形表示该角色不会遮挡其他角色
+    virtual Rect GetOpaqueBounds() const;
+
     /// \~chinese
     /// @brief 获取二维变换矩阵
     Matrix3x2 const& GetTransformMatrix() const;
@@ -315,6 +331,31 @@ public:
     /// @brief 设置 Z 轴顺序，默认为 0
     void SetZOrder(int zorder);
 
+    /// \~chinese
+    /// @brief 标记角色的显示内容已改变
+    /// @details 启用局部重绘时，变换、大小、透明度和可见性的变化会被自动记录，
+    /// 自定义绘制内容发生变化后需要调用该函数
+    void Invalidate();
+
+    /// \~chinese
+    /// @brief 设置是否为静态角色，默认为 false
+    /// @details 静态角色及其所有子角色的绘制结果会被缓存到纹理中，之后每帧仅绘制一次该纹理，
+    /// 任意子角色的属性或内容发生变化时缓存自动失效
+    void SetStatic(bool enable);
+
+    /// \~chinese
+    /// @brief 释放可以重新创建的资源
+    /// @details 舞台休眠时对舞台中的每个角色调用，默认释放静态缓存纹理，精灵、文字角色和画布还会释放各自的纹理或文字布局，
+    /// 被释放的资源在下次渲染时重新创建。
+    /// 重载该函数以释放自定义的资源
+    /// @return 释放的内存大小（字节）
+    virtual size_t ReleaseResources();
+
+    /// \~chinese
+    /// @brief 设置不透明区域，默认为空
+    /// @details 区域以角色自身坐标系表示，仅在角色透明度为 1 且未发生旋转或斜切时生效
+    void SetOpaqueBounds(Rect const& bounds);
+
     /// \~chinese
     /// @brief 设置角色是否可响应，默认为 false
     /// @details 可响应的角色会收到鼠标的 Hover | Out | Click 消息
@@ -427,6 +468,51 @@ protected:
     /// @brief 渲染前初始化渲染上下文状态，仅当 CheckVisibility 返回真时调用该函数
     virtual void PrepareToRender(RenderContext& ctx);
 
+    /// \~chinese
+    /// @brief 按从前到后的顺序检查自身和所有子角色是否被遮挡
+    /// @param occluders 已接受的遮挡区域
+    virtual void UpdateOcclusion(Vector<Rect>& occluders, RenderContext& ctx);
+
+    /// \~chinese
+    /// @brief 清除自身和所有子角色的遮挡状态
+    void ResetOcclusion();
+
+    /// \~chinese
+    /// @brief 使自身和所有父角色的静态缓存失效
+    void ExpireStaticCache();
+
+    /// \~chinese
+    /// @brief 绘制自身和所有子角色，不使用静态缓存
+    void RenderSelfAndChildren(RenderContext& ctx);
+
+    /// \~chinese
+    /// @brief 绘制自身
+    void RenderSelf(RenderContext& ctx);
+
+    /// \~chinese
+    /// @brief 获取以自身为根的统计数据，不是统计根节点时返回空
+    SceneStatistics* GetStatisticsScope(Profiler& profiler, Profiler::Phase phase);
+
+    /// \~chinese
+    /// @brief 通过静态缓存绘制自身和所有子角色
+    void RenderStaticCache(RenderContext& ctx);
+
+    /// \~chinese
+    /// @brief 计算子树在指定坐标系下的边界，并标记子角色需要重新检查可见性
+    void ComputeSubtreeBounds(Matrix3x2 const& to_local, Rect& bounds) const;
+
+    /// \~chinese
+    /// @brief 获取需要重绘的区域，以角色自身坐标系表示
+    virtual Rect GetDamageBounds() const;
+
+    /// \~chinese
+    /// @brief 收集自身和所有子角色的脏区域
+    void CollectDamage(DamageRegion& region);
+
+    /// \~chinese
+    /// @brief 将自身和所有子角色上次绘制的区域加入脏区域
+    void DiscardDamage(DamageRegion& region);
+
     /// \~chinese
     /// @brief 更新自己的二维变换，并通知所有子角色
     void UpdateTransform() const;
@@ -455,6 +541,9 @@ private:
     bool           hover_;
     bool           pressed_;
     bool           responsible_;
+    bool           is_static_;
+    bool           cache_expired_;
+    bool           tweened_;
     int            z_order_;
     float          opacity_;
     float          displayed_opacity_;
@@ -466,10 +555,18 @@ private:
     Children       children_;
     UpdateCallback cb_update_;
     Transform      transform_;
+    Rect           opaque_bounds_;
+    Rect           damage_bounds_;
+    Rect           cache_bounds_;
+
+    TexturePtr              cache_texture_;
+    TextureRenderContextPtr cache_ctx_;
 
     bool              is_fast_transform_;
+    bool              occluded_;
     mutable bool      visible_in_rt_;
     mutable bool      dirty_visibility_;
+    mutable bool      dirty_damage_;
     mutable bool      dirty_transform_;
     mutable bool      dirty_transform_inverse_;
     mutable Matrix3x2 transform_matrix_;
@@ -503,6 +600,11 @@ inline bool Actor::IsCascadeOpacityEnabled() const
     return cascade_opacity_;
 }
 
+inline bool Actor::IsStatic() const
+{
+    return is_static_;
+}
+
 inline size_t Actor::GetHashName() const
 {
     return hash_name_;
@@ -623,6 +725,22 @@ inline Transform Actor::GetTransform() const
     return transform_;
 }
 
+inline Rect Actor::GetOpaqueBounds() const
+{
+    return opaque_bounds_;
+}
+
+inline void Actor::SetOpaqueBounds(Rect const& bounds)
+{
+    opaque_bounds_ = bounds;
+}
+
+
+inline Rect Actor::GetDamageBounds() const
+{
+    return GetBounds();
+}
+
 inline Actor* Actor::GetParent() const
 {
     return parent_;
@@ -35,6 +35,7 @@ Canvas::Canvas()
     : cache_expired_(false)
     , stroke_width_(1.0f)
     , stroke_style_()
+    , redraw_(false)
 {
 }
 
@@ -51,10 +52,39 @@ void Canvas::EndDraw()
     InitRenderTargetAndBrushs();
     ctx_->EndDraw();
     cache_expired_ = true;
+    Invalidate();
+}
+
+size_t Canvas::ReleaseResources()
+{
+    size_t released = Actor::ReleaseResources();
+
+    // Without a redraw callback the content cannot be recreated
+    if (!cb_redraw_ || !ctx_)
+        return released;
+
+    if (texture_cached_ && texture_cached_->IsValid())
+    {
+        auto pixels = texture_cached_->GetSizeInPixels();
+        released += size_t(pixels.x) * pixels.y * 4;
+    }
+
+    ctx_.reset();
+    texture_cached_.reset();
+    cache_expired_ = false;
+    redraw_        = true;
+    return released;
 }
 
 void Canvas::OnRender(RenderContext& ctx)
 {
+    if (redraw_)
+    {
+        redraw_ = false;
+        if (cb_redraw_)
+            cb_redraw_(this);
+    }
+
     UpdateCache();
 
     if (texture_cached_ && texture_cached_->IsValid())
@@ -40,6 +40,10 @@ KGE_DECLARE_SMART_PTR(Canvas);
 class KGE_API Canvas : public Actor
 {
 public:
+    /// \~chinese
+    /// @brief 画布重绘回调函数
+    using RedrawCallback = Function<void(Canvas*)>;
+
     /// \~chinese
     /// @brief 创建画布
     static CanvasPtr Create();
@@ -276,6 +280,21 @@ public:
     /// @brief 导出纹理
     TexturePtr ExportToTexture() const;
 
+    /// \~chinese
+    /// @brief 设置重绘回调函数
+    /// @details 画布内容只保存在显存中，设置重绘回调后画布才能在舞台休眠时释放其纹理，
+    /// 下次渲染前调用回调函数重新绘制画布内容
+    void SetCallbackOnRedraw(RedrawCallback const& cb);
+
+    /// \~chinese
+    /// @brief 获取重绘回调函数
+    RedrawCallback GetCallbackOnRedraw() const;
+
+    /// \~chinese
+    /// @brief 释放可以重新创建的资源
+    /// @details 仅在设置了重绘回调函数时释放画布纹理
+    size_t ReleaseResources() override;
+
     void OnRender(RenderContext& ctx) override;
 
 private:
@@ -290,6 +309,8 @@ private:
     ShapeSink      shape_sink_;
     BrushPtr       fill_brush_;
     BrushPtr       stroke_brush_;
+    bool           redraw_;
+    RedrawCallback cb_redraw_;
 
     mutable bool                    cache_expired_;
     mutable TexturePtr              texture_cached_;
@@ -298,6 +319,16 @@ private:
 
 /** @} */
 
+inline void Canvas::SetCallbackOnRedraw(RedrawCallback const& cb)
+{
+    cb_redraw_ = cb;
+}
+
+inline Canvas::RedrawCallback Canvas::GetCallbackOnRedraw() const
+{
+    return cb_redraw_;
+}
+
 inline void Canvas::SetStrokeWidth(float width)
 {
     stroke_width_ = std::max(width, 0.f);
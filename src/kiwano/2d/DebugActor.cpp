@@ -19,8 +19,12 @@
 // THE SOFTWARE.
 
 #include <kiwano/2d/DebugActor.h>
+#include <kiwano/2d/Stage.h>
+#include <kiwano/core/Director.h>
 #include <kiwano/core/Logger.h>
+#include <kiwano/core/Profiler.h>
 #include <kiwano/render/Renderer.h>
+#include <iomanip>
 #include <psapi.h>
 
 #pragma comment(lib, "psapi.lib")
@@ -110,6 +114,26 @@ void DebugActor::OnUpdate(Duration dt)
 
     ss << "Primitives / sec: " << std::fixed << status.primitives * frame_time_.size() << std::endl;
 
+    ss << "Actors: " << status.drawn_actors << " drawn, " << status.culled_actors << " culled" << std::endl;
+
+    ss << "Static cache: " << status.static_cache_hits << " hits, " << status.static_cache_misses << " misses"
+       << std::endl;
+
+    if (Profiler::Instance().IsEnabled())
+    {
+        StagePtr stage = Director::Instance().GetCurrentStage();
+        if (stage)
+        {
+            const SceneStatistics& stats = stage->GetStatistics();
+
+            ss << "Scene: " << stats.actors << " actors, depth " << stats.max_depth << std::endl;
+            ss << "Update / Render: " << std::fixed << std::setprecision(2) << stats.update_time << " / "
+               << stats.render_time << "ms" << std::endl;
+            ss << "Ticks: " << stats.actions_ticked << " actions, " << stats.timers_ticked << " timers, "
+               << stats.listeners_invoked << " listeners" << std::endl;
+        }
+    }
+
     ss << "Memory: ";
     {
         PROCESS_MEMORY_COUNTERS_EX pmc;
@@ -157,6 +157,7 @@ void GifSprite::ComposeNextFrame()
         } while (frame_.delay.IsZero() && !IsLastFrame());
 
         animating_ = (!EndOfAnimation() && gif_->GetFramesCount() > 1);
+        Invalidate();
     }
 }
 
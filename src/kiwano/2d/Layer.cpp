@@ -80,6 +80,16 @@ void Layer::Render(RenderContext& ctx)
     ctx.PopLayer();
 }
 
+void Layer::UpdateOcclusion(Vector<Rect>& occluders, RenderContext& ctx)
+{
+    // Children are clipped and blended with the layer, they can only
+    // occlude each other
+    KGE_NOT_USED(occluders);
+
+    Vector<Rect> layer_occluders;
+    Actor::UpdateOcclusion(layer_occluders, ctx);
+}
+
 bool Layer::CheckVisibility(RenderContext& ctx) const
 {
     // Do not need to render Layer
@@ -90,6 +90,8 @@ public:
 protected:
     void Render(RenderContext& ctx) override;
 
+    void UpdateOcclusion(Vector<Rect>& occluders, RenderContext& ctx) override;
+
     bool CheckVisibility(RenderContext& ctx) const override;
 
 private:
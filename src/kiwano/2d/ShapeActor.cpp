@@ -62,11 +62,13 @@ bool ShapeActor::ContainsPoint(const Point& point) const
 void ShapeActor::SetStrokeWidth(float width)
 {
     stroke_width_ = std::max(width, 0.f);
+    Invalidate();
 }
 
 void ShapeActor::SetStrokeStyle(StrokeStylePtr stroke_style)
 {
     stroke_style_ = stroke_style;
+    Invalidate();
 }
 
 void ShapeActor::SetShape(ShapePtr shape)
@@ -82,6 +84,14 @@ void ShapeActor::SetShape(ShapePtr shape)
         bounds_ = Rect{};
         SetSize(0.f, 0.f);
     }
+    Invalidate();
+}
+
+Rect ShapeActor::GetDamageBounds() const
+{
+    // strokes are drawn with twice width and cover outside of the shape
+    return Rect{ bounds_.left_top - Vec2{ stroke_width_, stroke_width_ },
+                 bounds_.right_bottom + Vec2{ stroke_width_, stroke_width_ } };
 }
 
 void ShapeActor::OnRender(RenderContext& ctx)
@@ -162,6 +172,20 @@ void RectActor::SetRectSize(Size const& size)
     }
 }
 
+Rect RectActor::GetOpaqueBounds() const
+{
+    Rect opaque_bounds = ShapeActor::GetOpaqueBounds();
+    if (opaque_bounds.IsEmpty())
+    {
+        BrushPtr fill_brush = GetFillBrush();
+        if (fill_brush && fill_brush->IsOpaque())
+        {
+            opaque_bounds = Rect{ Point{}, rect_size_ };
+        }
+    }
+    return opaque_bounds;
+}
+
 //-------------------------------------------------------
 // RoundedRectActor
 //-------------------------------------------------------
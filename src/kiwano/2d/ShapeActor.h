@@ -127,6 +127,8 @@ public:
 protected:
     bool CheckVisibility(RenderContext& ctx) const override;
 
+    Rect GetDamageBounds() const override;
+
 private:
     BrushPtr       fill_brush_;
     BrushPtr       stroke_brush_;
@@ -203,6 +205,11 @@ public:
     /// @param size 矩形大小
     void SetRectSize(Size const& size);
 
+    /// \~chinese
+    /// @brief 获取不透明区域
+    /// @details 使用不透明纯色填充时，整个矩形都是不透明区域
+    Rect GetOpaqueBounds() const override;
+
 private:
     Size rect_size_;
 };
@@ -335,6 +342,7 @@ inline void ShapeActor::SetStrokeColor(Color const& color)
         stroke_brush_ = new Brush;
     }
     stroke_brush_->SetColor(color);
+    Invalidate();
 }
 
 inline void ShapeActor::SetFillColor(Color const& color)
@@ -344,15 +352,18 @@ inline void ShapeActor::SetFillColor(Color const& color)
         fill_brush_ = new Brush;
     }
     fill_brush_->SetColor(color);
+    Invalidate();
 }
 
 inline void ShapeActor::SetFillBrush(BrushPtr brush)
 {
     fill_brush_ = brush;
+    Invalidate();
 }
 inline void ShapeActor::SetStrokeBrush(BrushPtr brush)
 {
     stroke_brush_ = brush;
+    Invalidate();
 }
 inline BrushPtr ShapeActor::GetFillBrush() const
 {
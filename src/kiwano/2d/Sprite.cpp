@@ -19,7 +19,9 @@
 // THE SOFTWARE.
 
 #include <kiwano/2d/Sprite.h>
+#include <kiwano/core/Logger.h>
 #include <kiwano/render/Renderer.h>
+#include <kiwano/render/TextureCache.h>
 
 namespace kiwano
 {
@@ -56,7 +58,10 @@ SpritePtr Sprite::Create(FramePtr frame)
     return ptr;
 }
 
-Sprite::Sprite() {}
+Sprite::Sprite()
+    : released_(false)
+{
+}
 
 Sprite::~Sprite() {}
 
@@ -66,6 +71,7 @@ bool Sprite::Load(String const& file_path)
     if (frame->Load(file_path))
     {
         SetFrame(frame);
+        source_path_ = file_path;
         return true;
     }
     return false;
@@ -77,6 +83,7 @@ bool Sprite::Load(Resource const& res)
     if (frame->Load(res))
     {
         SetFrame(frame);
+        source_res_ = res;
         return true;
     }
     return false;
@@ -88,11 +95,16 @@ void Sprite::SetCropRect(const Rect& crop_rect)
     {
         frame_->SetCropRect(crop_rect);
         SetSize(Size{ frame_->GetWidth(), frame_->GetHeight() });
+        Invalidate();
     }
 }
 
 void Sprite::SetFrame(FramePtr frame)
 {
+    released_    = false;
+    source_path_ = String();
+    source_res_  = Resource();
+
     if (frame_ != frame)
     {
         frame_ = frame;
@@ -100,7 +112,80 @@ void Sprite::SetFrame(FramePtr frame)
         {
             SetSize(Size{ frame_->GetWidth(), frame_->GetHeight() });
         }
+        Invalidate();
+    }
+}
+
+Rect Sprite::GetOpaqueBounds() const
+{
+    Rect opaque_bounds = Actor::GetOpaqueBounds();
+    if (opaque_bounds.IsEmpty() && frame_ && frame_->IsValid())
+    {
+        if (frame_->GetTexture()->IsOpaque())
+        {
+            opaque_bounds = GetBounds();
+        }
+    }
+    return opaque_bounds;
+}
+
+size_t Sprite::ReleaseResources()
+{
+    size_t released = Actor::ReleaseResources();
+
+    // Frames set by the user or shared with other sprites cannot be reloaded here
+    if (!frame_ || !frame_->IsValid() || frame_->GetRefCount() > 1)
+        return released;
+
+    if (source_path_.empty() && source_res_.GetId() == 0)
+        return released;
+
+    TexturePtr texture = frame_->GetTexture();
+    released_crop_     = frame_->GetCropRect();
+    released_          = true;
+    frame_             = nullptr;
+
+    // Referenced only by the texture cache and this function
+    if (texture->GetRefCount() <= 2)
+    {
+        auto pixels = texture->GetSizeInPixels();
+        released += size_t(pixels.x) * pixels.y * 4;
+
+        if (!source_path_.empty())
+            TextureCache::Instance().RemoveTexture(source_path_);
+        else
+            TextureCache::Instance().RemoveTexture(source_res_);
+    }
+    return released;
+}
+
+void Sprite::RestoreFrame()
+{
+    FramePtr frame = new (std::nothrow) Frame;
+    if (frame)
+    {
+        bool loaded = source_path_.empty() ? frame->Load(source_res_) : frame->Load(source_path_);
+        if (loaded)
+        {
+            frame->SetCropRect(released_crop_);
+            frame_    = frame;
+            released_ = false;
+            Invalidate();
+            return;
+        }
+    }
+
+    KGE_WARN(L"Sprite failed to restore released frame");
+    released_ = false;
+}
+
+void Sprite::Render(RenderContext& ctx)
+{
+    if (released_)
+    {
+        RestoreFrame();
     }
+    Actor::Render(ctx);
 }
 
 void Sprite::OnRender(RenderContext& ctx)
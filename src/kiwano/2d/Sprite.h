@@ -81,12 +81,32 @@ public:
     /// @param[in] frame 图像帧
     void SetFrame(FramePtr frame);
 
+    /// \~chinese
+    /// @brief 获取不透明区域
+    /// @details 纹理不透明时（见 Texture::IsOpaque），整个精灵都是不透明区域
+    Rect GetOpaqueBounds() const override;
+
+    /// \~chinese
+    /// @brief 释放可以重新创建的资源
+    /// @details 从本地图片或图片资源加载的精灵会释放其图像帧，纹理不再被其他对象引用时从纹理缓存中移除，
+    /// 下次渲染时重新加载
+    size_t ReleaseResources() override;
+
     void OnRender(RenderContext& ctx) override;
 
 protected:
+    void Render(RenderContext& ctx) override;
+
     bool CheckVisibility(RenderContext& ctx) const override;
 
 private:
+    void RestoreFrame();
+
+private:
+    bool     released_;
+    Rect     released_crop_;
+    String   source_path_;
+    Resource source_res_;
     FramePtr frame_;
 };
 
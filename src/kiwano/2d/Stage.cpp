@@ -21,9 +21,46 @@
 #include <kiwano/2d/Stage.h>
 #include <kiwano/core/Logger.h>
 #include <kiwano/render/Renderer.h>
+#include <kiwano/utils/SceneFile.h>
 
 namespace kiwano
 {
+namespace
+{
+
+size_t ReleaseChildrenResources(Actor* parent)
+{
+    size_t released = 0;
+    for (auto& child : parent->GetAllChildren())
+    {
+        released += child.ReleaseResources();
+        released += ReleaseChildrenResources(&child);
+    }
+    return released;
+}
+
+uint32_t CountChildren(Actor* parent)
+{
+    uint32_t count = 0;
+    for (auto& child : parent->GetAllChildren())
+    {
+        count += 1 + CountChildren(&child);
+    }
+    return count;
+}
+
+String CreateTempFile()
+{
+    wchar_t temp_dir[MAX_PATH]  = {};
+    wchar_t temp_file[MAX_PATH] = {};
+    if (::GetTempPathW(MAX_PATH, temp_dir) && ::GetTempFileNameW(temp_dir, L"kgs", 0, temp_file))
+    {
+        return temp_file;
+    }
+    return String();
+}
+
+}  // namespace
 
 StagePtr Stage::Create()
 {
@@ -32,6 +69,10 @@ StagePtr Stage::Create()
 }
 
 Stage::Stage()
+    : occlusion_culling_(false)
+    , damage_tracking_(false)
+    , hibernating_(false)
+    , hibernation_mode_(HibernationMode::None)
 {
     SetStage(this);
 
@@ -39,7 +80,13 @@ Stage::Stage()
     SetSize(Renderer::Instance().GetOutputSize());
 }
 
-Stage::~Stage() {}
+Stage::~Stage()
+{
+    if (!hibernation_file_.empty())
+    {
+        ::DeleteFileW(hibernation_file_.c_str());
+    }
+}
 
 void Stage::OnEnter()
 {
@@ -51,6 +98,185 @@ void Stage::OnExit()
     KGE_SYS_LOG(L"Stage exited");
 }
 
+void Stage::OnHibernate() {}
+
+void Stage::OnWakeUp() {}
+
+size_t Stage::ReleaseResources()
+{
+    size_t released = Actor::ReleaseResources();
+    if (retained_texture_)
+    {
+        auto pixels = retained_texture_->GetSizeInPixels();
+        released += size_t(pixels.x) * pixels.y * 4;
+    }
+
+    // The retained texture is recreated and fully redrawn on the next render
+    retained_ctx_.reset();
+    retained_texture_.reset();
+
+    return released + ReleaseChildrenResources(this);
+}
+
+void Stage::Hibernate()
+{
+    if (hibernating_ || hibernation_mode_ == HibernationMode::None)
+        return;
+
+    const int64_t start = Time::NowMicroseconds();
+
+    String file_path;
+    if (hibernation_mode_ == HibernationMode::Serialize)
+    {
+        file_path = CreateTempFile();
+        if (file_path.empty() || !SceneWriter::SaveChildren(this, file_path))
+        {
+            // Trees that cannot be restored exactly are kept in memory
+            KGE_WARN(L"Stage cannot be serialized, only resources are released");
+
+            if (!file_path.empty())
+                ::DeleteFileW(file_path.c_str());
+            file_path.clear();
+        }
+    }
+
+    // Release after serializing, the writer still needs the sprite frames
+    hibernation_status_.released_bytes  = ReleaseResources();
+    hibernation_status_.released_actors = 0;
+
+    if (!file_path.empty())
+    {
+        hibernation_status_.released_actors = CountChildren(this);
+        hibernation_file_                   = file_path;
+        RemoveAllChildren();
+    }
+
+    OnHibernate();
+
+    hibernating_                       = true;
+    hibernation_status_.hibernate_time = Time::NowMicroseconds() - start;
+
+    KGE_SYS_LOG(L"Stage hibernated");
+}
+
+void Stage::WakeUp()
+{
+    if (!hibernating_)
+        return;
+
+    const int64_t start = Time::NowMicroseconds();
+
+    if (!hibernation_file_.empty())
+    {
+        if (!SceneLoader::LoadChildren(this, hibernation_file_))
+        {
+            KGE_ERROR(L"Failed to restore stage from %s", hibernation_file_.c_str());
+        }
+
+        ::DeleteFileW(hibernation_file_.c_str());
+        hibernation_file_.clear();
+    }
+
+    OnWakeUp();
+
+    hibernating_                     = false;
+    hibernation_status_.restore_time = Time::NowMicroseconds() - start;
+
+    KGE_SYS_LOG(L"Stage woke up");
+}
+
+void Stage::SetOcclusionCullingEnabled(bool enabled)
+{
+    if (occlusion_culling_ == enabled)
+        return;
+
+    occlusion_culling_ = enabled;
+    if (!occlusion_culling_)
+    {
+        ResetOcclusion();
+    }
+}
+
+void Stage::SetDamageTrackingEnabled(bool enabled)
+{
+    if (damage_tracking_ == enabled)
+        return;
+
+    damage_tracking_ = enabled;
+    if (!damage_tracking_)
+    {
+        // release the retained texture
+        retained_ctx_.reset();
+        retained_texture_.reset();
+        damage_.Clear();
+    }
+}
+
+void Stage::Render(RenderContext& ctx)
+{
+    if (occlusion_culling_)
+    {
+        occluders_.clear();
+        UpdateOcclusion(occluders_, ctx);
+    }
+
+    if (damage_tracking_)
+    {
+        RenderDamagedRegion(ctx);
+    }
+    else
+    {
+        Actor::Render(ctx);
+    }
+}
+
+void Stage::RenderDamagedRegion(RenderContext& ctx)
+{
+    Size output_size = Renderer::Instance().GetOutputSize();
+    if (!retained_ctx_ || !retained_ctx_->IsValid() || retained_size_ != output_size)
+    {
+        retained_ctx_.reset();
+        Renderer::Instance().CreateTextureRenderTarget(retained_ctx_);
+
+        retained_texture_ = new Texture;
+        retained_ctx_->GetOutput(*retained_texture_);
+        retained_size_ = output_size;
+
+        damage_.SetBounds(Rect{ Point{}, output_size });
+        damage_.Invalidate();
+    }
+
+    CollectDamage(damage_);
+
+    if (!damage_.IsEmpty())
+    {
+        // Actors drawn into the retained texture are counted by the output context
+        retained_ctx_->SetCollectingStatus(ctx.IsCollectingStatus());
+        retained_ctx_->BeginDraw();
+        for (const auto& rect : damage_.GetRects())
+        {
+            retained_ctx_->SetTransform(Matrix3x2());
+            retained_ctx_->PushClipRect(rect);
+            retained_ctx_->Clear(Color::Transparent);
+
+            Actor::Render(*retained_ctx_);
+
+            retained_ctx_->SetTransform(Matrix3x2());
+            retained_ctx_->PopClipRect();
+        }
+        retained_ctx_->EndDraw();
+        ctx.MergeStatus(retained_ctx_->GetStatus());
+        damage_.Clear();
+    }
+
+    if (retained_texture_->IsValid())
+    {
+        ctx.SetTransform(Matrix3x2());
+        ctx.SetBrushOpacity(1.f);
+        ctx.DrawTexture(*retained_texture_);
+    }
+}
+
 void Stage::RenderBorder(RenderContext& ctx)
 {
     ctx.SetBrushOpacity(GetDisplayedOpacity());
@@ -21,6 +21,8 @@
 #pragma once
 #include <kiwano/2d/Actor.h>
 #include <kiwano/render/Brush.h>
+#include <kiwano/render/DamageRegion.h>
+#include <kiwano/render/RenderContext.h>
 
 namespace kiwano
 {
@@ -39,10 +41,33 @@ KGE_DECLARE_SMART_PTR(Stage);
  */
 class KGE_API Stage : public Actor
 {
+    friend class Actor;
     friend class Transition;
     friend class Director;
 
 public:
+    /// \~chinese
+    /// @brief 休眠模式
+    enum class HibernationMode
+    {
+        None,              ///< 不休眠
+        ReleaseResources,  ///< 释放所有角色可重新创建的资源
+        Serialize,         ///< 释放资源，并将角色树序列化到临时场景文件后移除
+    };
+
+    /// \~chinese
+    /// @brief 休眠状态
+    struct HibernationStatus
+    {
+        size_t   released_bytes;   ///< 上次休眠释放的资源大小（字节）
+        uint32_t released_actors;  ///< 上次休眠移除的角色数量
+        int64_t  hibernate_time;   ///< 上次休眠的耗时（微秒）
+        int64_t  restore_time;     ///< 上次恢复的耗时（微秒）
+
+        HibernationStatus();
+    };
+
+
     /// \~chinese
     /// @brief 进入舞台时
     static StagePtr Create();
@@ -77,14 +102,109 @@ public:
     /// @brief 设置角色边界轮廓画刷
     void SetBorderStrokeBrush(BrushPtr brush);
 
+    /// \~chinese
+    /// @brief 是否启用了遮挡剔除
+    bool IsOcclusionCullingEnabled() const;
+
+    /// \~chinese
+    /// @brief 启用或禁用遮挡剔除，默认禁用
+    /// @details 启用后每帧渲染前从前到后检查角色，跳过被其他角色不透明区域完全覆盖的角色
+    /// @see Actor::SetOpaqueBounds
+    void SetOcclusionCullingEnabled(bool enabled);
+
+    /// \~chinese
+    /// @brief 是否启用了局部重绘
+    bool IsDamageTrackingEnabled() const;
+
+    /// \~chinese
+    /// @brief 启用或禁用局部重绘，默认禁用
+    /// @details 启用后舞台被渲染到一张保留的纹理中，每帧仅重绘角色发生变化的区域，
+    /// 变化区域过大时退化为全屏重绘
+    /// @see Actor::Invalidate
+    void SetDamageTrackingEnabled(bool enabled);
+
+    /// \~chinese
+    /// @brief 获取脏区域
+    DamageRegion const& GetDamageRegion() const;
+
+    /// \~chinese
+    /// @brief 获取上一帧的场景统计信息
+    /// @note 仅在启用性能分析时更新
+    /// @see Profiler::SetEnabled
+    SceneStatistics const& GetStatistics() const;
+
+    /// \~chinese
+    /// @brief 获取休眠模式
+    HibernationMode GetHibernationMode() const;
+
+    /// \~chinese
+    /// @brief 设置休眠模式，默认不休眠
+    /// @details 舞台被压入舞台栈且不再显示时进入休眠，从舞台栈中弹出时恢复。
+    /// 序列化模式适用于不持有子角色引用的舞台，子角色带有场景文件无法保存的状态时（如动画、监听器、定时器），
+    /// 舞台只释放资源而不会被序列化
+    /// @see SceneWriter::SaveChildren
+    void SetHibernationMode(HibernationMode mode);
+
+    /// \~chinese
+    /// @brief 是否正在休眠
+    bool IsHibernating() const;
+
+    /// \~chinese
+    /// @brief 获取休眠状态
+    HibernationStatus const& GetHibernationStatus() const;
+
+    /// \~chinese
+    /// @brief 释放舞台的保留纹理和所有角色可以重新创建的资源
+    size_t ReleaseResources() override;
+
+    /// \~chinese
+    /// @brief 进入休眠时
+    /// @details 重载该函数以释放自定义的资源
+    virtual void OnHibernate();
+
+    /// \~chinese
+    /// @brief 从休眠中恢复时
+    /// @details 重载该函数以恢复 OnHibernate 中释放的资源
+    virtual void OnWakeUp();
+
 protected:
+    /// \~chinese
+    /// @brief 渲染自身和所有子角色
+    void Render(RenderContext& ctx) override;
+
     /// \~chinese
     /// @brief 绘制所有子角色的边界
     void RenderBorder(RenderContext& ctx) override;
 
 private:
-    BrushPtr border_fill_brush_;
-    BrushPtr border_stroke_brush_;
+    /// \~chinese
+    /// @brief 仅重绘脏区域，并将保留的纹理绘制到渲染上下文中
+    void RenderDamagedRegion(RenderContext& ctx);
+
+    /// \~chinese
+    /// @brief 进入休眠
+    void Hibernate();
+
+    /// \~chinese
+    /// @brief 从休眠中恢复
+    void WakeUp();
+
+private:
+    bool                    occlusion_culling_;
+    bool                    damage_tracking_;
+    bool                    hibernating_;
+    HibernationMode         hibernation_mode_;
+    HibernationStatus       hibernation_status_;
+    String                  hibernation_file_;
+    BrushPtr                border_fill_brush_;
+    BrushPtr                border_stroke_brush_;
+    Vector<Rect>            occluders_;
+    DamageRegion            damage_;
+    Size                    retained_size_;
+    TexturePtr              retained_texture_;
+    TextureRenderContextPtr retained_ctx_;
+    SceneStatistics         stats_;
+    SceneStatistics         last_stats_;
 };
 
 /** @} */
@@ -108,4 +228,53 @@ inline void Stage::SetBorderStrokeBrush(BrushPtr brush)
 {
     border_stroke_brush_ = brush;
 }
+
+inline bool Stage::IsOcclusionCullingEnabled() const
+{
+    return occlusion_culling_;
+}
+
+inline bool Stage::IsDamageTrackingEnabled() const
+{
+    return damage_tracking_;
+}
+
+inline DamageRegion const& Stage::GetDamageRegion() const
+{
+    return damage_;
+}
+
+inline SceneStatistics const& Stage::GetStatistics() const
+{
+    return last_stats_;
+}
+
+inline Stage::HibernationStatus::HibernationStatus()
+    : released_bytes(0)
+    , released_actors(0)
+    , hibernate_time(0)
+    , restore_time(0)
+{
+}
+
+inline Stage::HibernationMode Stage::GetHibernationMode() const
+{
+    return hibernation_mode_;
+}
+
+inline void Stage::SetHibernationMode(HibernationMode mode)
+{
+    hibernation_mode_ = mode;
+}
+
+inline bool Stage::IsHibernating() const
+{
+    return hibernating_;
+}
+
+inline Stage::HibernationStatus const& Stage::GetHibernationStatus() const
+{
+    return hibernation_status_;
+}
+
 }  // namespace kiwano
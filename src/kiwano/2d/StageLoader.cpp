@@ -0,0 +1,177 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <kiwano/2d/StageLoader.h>
+#include <kiwano/core/Logger.h>
+#include <kiwano/core/ThreadPool.h>
+#include <kiwano/platform/Application.h>
+
+namespace kiwano
+{
+
+StageLoaderPtr StageLoader::Create(StagePtr stage)
+{
+    StageLoaderPtr ptr = new (std::nothrow) StageLoader;
+    if (ptr)
+    {
+        ptr->SetStage(stage);
+    }
+    return ptr;
+}
+
+StageLoader::StageLoader()
+    : started_(false)
+    , scheduled_(false)
+    , loaded_(false)
+    , progress_(0)
+    , job_index_(0)
+    , job_priority_(0)
+    , cancelled_(false)
+    , tasks_done_(0)
+{
+}
+
+StageLoader::~StageLoader()
+{
+    if (!started_)
+        return;
+
+    // Background tasks refer to this loader, skip the queued ones and wait for the running ones
+    cancelled_ = true;
+
+    std::unique_lock<std::mutex> lock(tasks_mutex_);
+    tasks_cond_.wait(lock, [this]() { return tasks_done_.load() == tasks_.size(); });
+}
+
+void StageLoader::AddBackgroundTask(Task const& task)
+{
+    KGE_ASSERT(!started_ && "Tasks cannot be added after the loading has started");
+
+    if (task && !started_)
+    {
+        tasks_.push_back(task);
+    }
+}
+
+void StageLoader::AddJob(Job const& job)
+{
+    KGE_ASSERT(!started_ && "Jobs cannot be added after the loading has started");
+
+    if (job && !started_)
+    {
+        jobs_.push_back(job);
+    }
+}
+
+void StageLoader::Start()
+{
+    started_ = true;
+
+    // Reference counts are not thread-safe, so workers get a raw pointer and an index only.
+    // The loader is kept alive by the main thread, and its destructor waits for the tasks.
+    ThreadPool& pool = ThreadPool::Instance();
+    for (size_t i = 0; i < tasks_.size(); ++i)
+    {
+        StageLoader* loader = this;
+        pool.SubmitBackground([loader, i]() { loader->RunTask(i); });
+    }
+}
+
+void StageLoader::RunTask(size_t index)
+{
+    if (!cancelled_)
+    {
+        try
+        {
+            tasks_[index]();
+        }
+        catch (std::exception& e)
+        {
+            KGE_ERROR(L"StageLoader background task failed: %s", oc::string_to_wide(e.what()).c_str());
+        }
+        catch (...)
+        {
+            KGE_ERROR(L"StageLoader background task failed");
+        }
+    }
+
+    // The loader may be destroyed once the lock is released, do not touch it after this
+    std::lock_guard<std::mutex> lock(tasks_mutex_);
+    ++tasks_done_;
+    tasks_cond_.notify_one();
+}
+
+bool StageLoader::Update()
+{
+    if (loaded_ || cancelled_)
+        return loaded_;
+
+    if (!started_)
+        Start();
+
+    const uint32_t tasks_done = tasks_done_.load();
+    if (tasks_done == tasks_.size() && job_index_ < jobs_.size() && !scheduled_)
+    {
+        if (Application* app = Application::GetCurrent())
+        {
+            // The job holds a reference, so the loader lives until its jobs finish or it is cancelled
+            StageLoaderPtr loader = this;
+            app->AddJob([loader]() { return loader->RunJob(); }, job_priority_);
+            scheduled_ = true;
+        }
+        else
+        {
+            RunJob();
+        }
+    }
+
+    const size_t total    = tasks_.size() + jobs_.size();
+    const float  progress = total ? float(tasks_done + job_index_) / float(total) : 1.f;
+
+    loaded_ = (tasks_done == tasks_.size() && job_index_ == jobs_.size());
+
+    if (progress != progress_)
+    {
+        progress_ = progress;
+        if (progress_cb_)
+        {
+            progress_cb_(progress_);
+        }
+    }
+    return loaded_;
+}
+
+void StageLoader::Cancel()
+{
+    cancelled_ = true;
+}
+
+bool StageLoader::RunJob()
+{
+    if (cancelled_ || job_index_ >= jobs_.size())
+        return false;
+
+    if (!jobs_[job_index_]())
+        ++job_index_;
+    return job_index_ < jobs_.size();
+}
+
+}  // namespace kiwano
@@ -0,0 +1,183 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+#include <kiwano/2d/Stage.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace kiwano
+{
+KGE_DECLARE_SMART_PTR(StageLoader);
+
+/**
+ * \addtogroup Actors
+ * @{
+ */
+
+/**
+ * \~chinese
+ * @brief 舞台加载器
+ * @details 分步加载舞台。后台任务在工作线程中并行执行，全部完成后，主线程任务作为 Application 的分时任务
+ * 在每帧的时间预算内依次执行，加载期间当前舞台继续更新和渲染。加载器被取消或销毁时，尚未开始的后台任务会被取消，
+ * 销毁时等待正在执行的后台任务结束
+ * @see kiwano::Director::EnterStageAsync
+ */
+class KGE_API StageLoader : public virtual ObjectBase
+{
+public:
+    /// \~chinese
+    /// @brief 后台任务
+    using Task = Function<void()>;
+
+    /// \~chinese
+    /// @brief 主线程任务
+    /// @details 每次调用执行一小部分工作，返回 true 表示还有剩余工作
+    using Job = Function<bool()>;
+
+    /// \~chinese
+    /// @brief 加载进度回调函数
+    using ProgressCallback = Function<void(float /* progress */)>;
+
+    /// \~chinese
+    /// @brief 创建舞台加载器
+    /// @param stage 需要加载的舞台
+    static StageLoaderPtr Create(StagePtr stage);
+
+    StageLoader();
+
+    virtual ~StageLoader();
+
+    /// \~chinese
+    /// @brief 获取需要加载的舞台
+    StagePtr GetStage() const;
+
+    /// \~chinese
+    /// @brief 设置需要加载的舞台
+    void SetStage(StagePtr stage);
+
+    /// \~chinese
+    /// @brief 添加后台任务
+    /// @details 后台任务在工作线程中执行，不能访问角色、渲染器等非线程安全的对象，适合读取文件、解析数据等工作
+    void AddBackgroundTask(Task const& task);
+
+    /// \~chinese
+    /// @brief 添加主线程任务
+    /// @details 主线程任务在所有后台任务完成后按添加顺序执行，适合创建纹理、构建角色树等工作
+    void AddJob(Job const& job);
+
+    /// \~chinese
+    /// @brief 设置主线程任务的优先级，默认为 0
+    /// @details 主线程任务通过 Application::AddJob 执行，共享分时任务的时间预算
+    /// @see kiwano::Application::AddJob
+    void SetJobPriority(int priority);
+
+    /// \~chinese
+    /// @brief 设置加载进度回调函数
+    /// @details 回调函数在主线程中执行，进度取值范围为 [0, 1]
+    void SetProgressCallback(ProgressCallback const& callback);
+
+    /// \~chinese
+    /// @brief 获取加载进度
+    float GetProgress() const;
+
+    /// \~chinese
+    /// @brief 是否已加载完成
+    bool IsLoaded() const;
+
+    /// \~chinese
+    /// @brief 推进加载
+    /// @details 第一次调用时开始执行后台任务，后台任务全部完成后将主线程任务交给 Application 执行
+    /// @return 加载完成时返回 true
+    bool Update();
+
+    /// \~chinese
+    /// @brief 取消加载
+    /// @details 尚未开始的后台任务和剩余的主线程任务不再执行
+    void Cancel();
+
+    /// \~chinese
+    /// @brief 是否已取消加载
+    bool IsCancelled() const;
+
+private:
+    void Start();
+
+    void RunTask(size_t index);
+
+    bool RunJob();
+
+private:
+    bool                    started_;
+    bool                    scheduled_;
+    bool                    loaded_;
+    float                   progress_;
+    size_t                  job_index_;
+    int                     job_priority_;
+    std::atomic<bool>       cancelled_;
+    std::atomic<uint32_t>   tasks_done_;
+    std::mutex              tasks_mutex_;
+    std::condition_variable tasks_cond_;
+    StagePtr                stage_;
+    Vector<Task>            tasks_;
+    Vector<Job>             jobs_;
+    ProgressCallback        progress_cb_;
+};
+
+/** @} */
+
+inline StagePtr StageLoader::GetStage() const
+{
+    return stage_;
+}
+
+inline void StageLoader::SetStage(StagePtr stage)
+{
+    stage_ = stage;
+}
+
+inline void StageLoader::SetJobPriority(int priority)
+{
+    job_priority_ = priority;
+}
+
+inline void StageLoader::SetProgressCallback(ProgressCallback const& callback)
+{
+    progress_cb_ = callback;
+}
+
+inline float StageLoader::GetProgress() const
+{
+    return progress_;
+}
+
+inline bool StageLoader::IsLoaded() const
+{
+    return loaded_;
+}
+
+inline bool StageLoader::IsCancelled() const
+{
+    return cancelled_;
+}
+
+}  // namespace kiwano
@@ -82,9 +82,30 @@ void TextActor::UpdateLayout()
             text_layout_.SetStrikethrough(true, 0, text_layout_.GetText().length());
 
         SetSize(text_layout_.GetLayoutSize());
+        Invalidate();
     }
 }
 
+size_t TextActor::ReleaseResources()
+{
+    // DirectWrite does not report the memory held by a layout, only the cache is counted
+    if (text_layout_.IsValid())
+    {
+        text_layout_.Discard();
+    }
+    return Actor::ReleaseResources();
+}
+
+void TextActor::Render(RenderContext& ctx)
+{
+    // Layouts released while hibernating are recreated even if updates are paused
+    if (!text_layout_.IsValid() && text_layout_.IsDirty())
+    {
+        UpdateLayout();
+    }
+    Actor::Render(ctx);
+}
+
 bool TextActor::CheckVisibility(RenderContext& ctx) const
 {
     return text_layout_.IsValid() && Actor::CheckVisibility(ctx);
@@ -98,6 +119,7 @@ void TextActor::SetFillColor(Color const& color)
         text_layout_.SetFillBrush(brush);
     }
     text_layout_.GetFillBrush()->SetColor(color);
+    Invalidate();
 }
 
 void TextActor::SetOutlineColor(Color const& outline_color)
@@ -108,6 +130,7 @@ void TextActor::SetOutlineColor(Color const& outline_color)
         text_layout_.SetOutlineBrush(brush);
     }
     text_layout_.GetOutlineBrush()->SetColor(outline_color);
+    Invalidate();
 }
 
 }  // namespace kiwano
@@ -159,11 +159,18 @@ public:
     /// @details 文字布局是懒更新的，手动更新文字布局以更新节点状态
     void UpdateLayout();
 
+    /// \~chinese
+    /// @brief 释放可以重新创建的资源
+    /// @details 释放文字布局，下次更新或渲染时重新创建
+    size_t ReleaseResources() override;
+
     void OnRender(RenderContext& ctx) override;
 
     void OnUpdate(Duration dt) override;
 
 protected:
+    void Render(RenderContext& ctx) override;
+
     bool CheckVisibility(RenderContext& ctx) const override;
 
 private:
@@ -262,30 +269,36 @@ inline void TextActor::SetAlignment(TextAlign align)
 inline void TextActor::SetUnderline(bool enable)
 {
     show_underline_ = enable;
+    Invalidate();
 }
 
 inline void TextActor::SetStrikethrough(bool enable)
 {
     show_strikethrough_ = enable;
+    Invalidate();
 }
 
 inline void TextActor::SetFillBrush(BrushPtr brush)
 {
     text_layout_.SetFillBrush(brush);
+    Invalidate();
 }
 
 inline void TextActor::SetOutlineBrush(BrushPtr brush)
 {
     text_layout_.SetOutlineBrush(brush);
+    Invalidate();
 }
 
 inline void TextActor::SetOutlineWidth(float outline_width)
 {
     text_layout_.SetOutlineWidth(outline_width);
+    Invalidate();
 }
 
 inline void TextActor::SetOutlineStroke(StrokeStylePtr outline_stroke)
 {
     text_layout_.SetOutlineStroke(outline_stroke);
+    Invalidate();
 }
 }  // namespace kiwano
@@ -18,15 +18,21 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <climits>
 #include <kiwano/2d/Actor.h>
 #include <kiwano/2d/action/Action.h>
+#include <kiwano/core/Logger.h>
+#include <kiwano/core/ObjectPool.h>
 
 namespace kiwano
 {
+const Duration Action::InfiniteDuration = LONG_MAX;
+
 Action::Action()
     : running_(true)
     , detach_target_(false)
     , loops_done_(0)
+    , init_loop_(0)
     , loops_(0)
     , status_(Status::NotStarted)
 {
@@ -34,6 +40,39 @@ Action::Action()
 
 Action::~Action() {}
 
+void* Action::operator new(size_t size)
+{
+    void* ptr = ObjectPool::Allocate(size);
+    if (!ptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* Action::operator new(size_t size, std::nothrow_t const&) noexcept
+{
+    return ObjectPool::Allocate(size);
+}
+
+void Action::operator delete(void* ptr, size_t size) noexcept
+{
+    ObjectPool::Free(ptr, size);
+}
+
+void Action::operator delete(void* ptr, std::nothrow_t const&) noexcept
+{
+    // Only called when a constructor throws, the block is not cached
+    ::operator delete(ptr);
+}
+
+void Action::Reset()
+{
+    status_     = Status::NotStarted;
+    running_    = true;
+    elapsed_    = 0;
+    loops_done_ = 0;
+    init_loop_  = 0;
+}
+
 void Action::Init(Actor* target) {}
 
 void Action::Update(Actor* target, Duration dt)
@@ -41,6 +80,146 @@ void Action::Update(Actor* target, Duration dt)
     Complete(target);
 }
 
+void Action::Sample(Actor* target, Duration time) {}
+
+bool Action::InitLoop(Actor* target, int loop)
+{
+    // The states of earlier loops are lost once the action is initialized again
+    if (loop < init_loop_)
+        return false;
+
+    const Duration duration = GetDuration();
+    while (init_loop_ < loop && status_ != Status::Done)
+    {
+        Sample(target, duration);
+        ++init_loop_;
+        Init(target);
+    }
+    return true;
+}
+
+Duration Action::GetDuration() const
+{
+    return 0;
+}
+
+Duration Action::GetTotalDuration() const
+{
+    Duration duration = GetDuration();
+    if (loops_ < 0 || duration == InfiniteDuration)
+        return InfiniteDuration;
+
+    // Saturate instead of overflowing for very long actions
+    long ms  = duration.Milliseconds();
+    long max = (LONG_MAX - delay_.Milliseconds()) / (long(loops_) + 1);
+    if (ms > max)
+        return InfiniteDuration;
+    return delay_ + duration * (loops_ + 1);
+}
+
+void Action::Seek(Actor* target, Duration time)
+{
+    KGE_ASSERT(target != nullptr && "Action target should NOT be nullptr!");
+
+    if (time < 0)
+        time = 0;
+
+    if (status_ == Status::NotStarted)
+    {
+        // Capture the initial state only once, later seeks move it between loops
+        status_    = Status::Started;
+        init_loop_ = 0;
+        Init(target);
+
+        if (status_ == Status::Done)
+            return;
+    }
+
+    if (time < delay_)
+    {
+        if (!SeekLoop(target, 0))
+            return;
+
+        elapsed_    = time;
+        loops_done_ = 0;
+        status_     = Status::Delayed;
+        return;
+    }
+
+    Duration duration = GetDuration();
+    Duration local    = time - delay_;
+
+    if (duration.IsZero())
+    {
+        elapsed_    = time;
+        loops_done_ = 0;
+        status_     = Status::Started;
+        if (loops_ >= 0)
+        {
+            loops_done_ = loops_ + 1;
+            status_     = Status::Done;
+        }
+        Sample(target, 0);
+        return;
+    }
+
+    if (duration == InfiniteDuration)
+    {
+        if (!SeekLoop(target, 0))
+            return;
+
+        elapsed_    = time;
+        loops_done_ = 0;
+        status_     = Status::Started;
+        Sample(target, local);
+        return;
+    }
+
+    long loops = local.Milliseconds() / duration.Milliseconds();
+    bool done  = (loops_ >= 0 && loops > loops_);
+    if (done)
+        loops = loops_;
+
+    if (!SeekLoop(target, static_cast<int>(loops)))
+        return;
+
+    elapsed_ = time;
+    if (done)
+    {
+        loops_done_ = loops_ + 1;
+        status_     = Status::Done;
+        Sample(target, duration);
+    }
+    else
+    {
+        loops_done_ = static_cast<int>(loops);
+        status_     = Status::Started;
+        Sample(target, local.Milliseconds() - loops * duration.Milliseconds());
+    }
+}
+
+bool Action::SeekLoop(Actor* target, int loop)
+{
+    if (loop == init_loop_)
+        return true;
+
+    // Sampling may complete the action, keep the status of the seek
+    Status status = status_;
+    status_       = Status::Started;
+
+    bool succeeded = InitLoop(target, loop);
+    status_        = status;
+
+    if (!succeeded)
+    {
+        KGE_WARN(L"Action::Seek failed: the action cannot return to an earlier loop");
+        return false;
+    }
+
+    init_loop_ = loop;
+    return true;
+}
+
 void Action::UpdateStep(Actor* target, Duration dt)
 {
     KGE_ASSERT(target != nullptr && "Action target should NOT be nullptr!");
@@ -49,7 +228,8 @@ void Action::UpdateStep(Actor* target, Duration dt)
 
     if (status_ == Status::NotStarted)
     {
-        status_ = delay_.IsZero() ? Status::Started : Status::Delayed;
+        status_    = delay_.IsZero() ? Status::Started : Status::Delayed;
+        init_loop_ = 0;
         Init(target);
     }
 
@@ -69,13 +249,7 @@ void Action::UpdateStep(Actor* target, Duration dt)
 
     if (status_ == Status::Done)
     {
-        if (cb_done_)
-            cb_done_(target);
-
-        if (detach_target_)
-            target->RemoveFromParent();
-
-        status_ = Status::Removeable;
+        Finish(target);
     }
 }
 
@@ -90,17 +264,30 @@ void Action::Complete(Actor* target)
     }
     else
     {
+        init_loop_ = loops_done_ + 1;
         Init(target);  // reinit when a loop is done
     }
 
     ++loops_done_;
 }
 
+void Action::Finish(Actor* target)
+{
+    if (cb_done_)
+        cb_done_(target);
+
+    if (detach_target_)
+        target->RemoveFromParent();
+
+    status_ = Status::Removeable;
+}
+
 void Action::Restart(Actor* target)
 {
     status_     = Status::NotStarted;
     elapsed_    = 0;
     loops_done_ = 0;
+    init_loop_  = 0;
 
     Init(target);
 }
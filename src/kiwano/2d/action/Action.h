@@ -50,6 +50,7 @@ class KGE_API Action
 {
     friend class ActionManager;
     friend class ActionGroup;
+    friend class TweenSystem;
     friend IntrusiveList<ActionPtr>;
 
 public:
@@ -61,6 +62,11 @@ public:
 
     virtual ~Action();
 
+    /// \~chinese
+    /// @brief 重置动画
+    /// @details 将已结束的动画恢复为未开始状态，可以重新添加到角色上，无需重新创建或克隆
+    void Reset();
+
     /// \~chinese
     /// @brief 继续动画
     void Resume();
@@ -114,6 +120,26 @@ public:
     /// @brief 获取动画的延时
     Duration GetDelay() const;
 
+    /// \~chinese
+    /// @brief 获取动画单次循环的时长
+    /// @details 立即完成的动画返回 0
+    virtual Duration GetDuration() const;
+
+    /// \~chinese
+    /// @brief 获取动画的总时长，包括延时和所有循环
+    /// @details 永久循环的动画返回 Action::InfiniteDuration
+    Duration GetTotalDuration() const;
+
+    /// \~chinese
+    /// @brief 跳转到指定时间
+    /// @details 直接计算动画在该时间的状态并应用到目标角色上，耗时与跳转的时长无关，
+    /// 可以向前或向后跳转。跨越循环时通过 InitLoop 得到该次循环开始时的状态，与播放到该时间的结果一致，
+    /// 无法回到较早循环的动画会拒绝跳转并保持原状态。跳转过程中不会触发回调函数。
+    /// 由 TweenSystem 批量更新的补间动画不支持跳转
+    /// @param target 目标角色
+    /// @param time 从动画开始计时的时间，包括延时
+    void Seek(Actor* target, Duration time);
+
     /// \~chinese
     /// @brief 获取动画结束时的回调函数
     DoneCallback GetDoneCallback() const;
@@ -122,6 +148,21 @@ public:
     /// @brief 获取动画循环结束时的回调函数
     DoneCallback GetLoopDoneCallback() const;
 
+    /// \~chinese
+    /// @brief 从内存池中申请内存
+    /// @see ObjectPool
+    static void* operator new(size_t size);
+
+    static void* operator new(size_t size, std::nothrow_t const&) noexcept;
+
+    static void operator delete(void* ptr, size_t size) noexcept;
+
+    static void operator delete(void* ptr, std::nothrow_t const&) noexcept;
+
+    /// \~chinese
+    /// @brief 永久循环的动画时长
+    static const Duration InfiniteDuration;
+
 protected:
     /// \~chinese
     /// @brief 初始化动画
@@ -131,6 +172,25 @@ protected:
     /// @brief 更新动画
     virtual void Update(Actor* target, Duration dt);
 
+    /// \~chinese
+    /// @brief 在单次循环内采样动画
+    /// @param target 目标角色
+    /// @param time 当前循环内的时间，范围为 [0, GetDuration()]
+    virtual void Sample(Actor* target, Duration time);
+
+    /// \~chinese
+    /// @brief 将初始化时记录的状态移动到指定循环开始时的状态，由 Seek 调用
+    /// @details 默认实现依次采样到每次循环结尾并重新初始化，与播放时的循环过程一致，但无法回到较早的循环。
+    /// 初始化时不依赖目标角色状态的动画可以直接返回 true，依赖的动画可以重载该函数直接计算对应循环的状态
+    /// @param target 目标角色
+    /// @param loop 循环次数
+    /// @return 是否成功
+    virtual bool InitLoop(Actor* target, int loop);
+
+    /// \~chinese
+    /// @brief 获取初始化时记录的状态所属的循环次数
+    int GetInitLoop() const;
+
     /// \~chinese
     /// @brief 更新一个时间步
     void UpdateStep(Actor* target, Duration dt);
@@ -139,6 +199,10 @@ protected:
     /// @brief 完成动画
     void Complete(Actor* target);
 
+    /// \~chinese
+    /// @brief 结束动画，调用结束回调并标记为可移除
+    void Finish(Actor* target);
+
     /// \~chinese
     /// @brief 重新开始动画
     void Restart(Actor* target);
@@ -178,12 +242,16 @@ protected:
     /// @brief 是否可移除
     bool IsRemoveable() const;
 
+private:
+    bool SeekLoop(Actor* target, int loop);
+
 private:
     Status       status_;
     bool         running_;
     bool         detach_target_;
     int          loops_;
     int          loops_done_;
+    int          init_loop_;
     Duration     delay_;
     Duration     elapsed_;
     DoneCallback cb_done_;
@@ -277,6 +345,11 @@ inline int Action::GetLoopsDone() const
     return loops_done_;
 }
 
+inline int Action::GetInitLoop() const
+{
+    return init_loop_;
+}
+
 inline Action::DoneCallback Action::GetDoneCallback() const
 {
     return cb_done_;
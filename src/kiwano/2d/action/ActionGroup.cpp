@@ -100,6 +100,71 @@ void ActionGroup::Update(Actor* target, Duration dt)
     }
 }
 
+Duration ActionGroup::GetDuration() const
+{
+    Duration duration;
+    for (auto action = actions_.first_item(); action; action = action->next_item())
+    {
+        Duration total = action->GetTotalDuration();
+        if (total == InfiniteDuration)
+            return InfiniteDuration;
+
+        if (sync_)
+            duration = std::max(duration, total);
+        else
+            duration += total;
+    }
+    return duration;
+}
+
+void ActionGroup::Sample(Actor* target, Duration time)
+{
+    if (sync_)
+    {
+        for (auto action = actions_.first_item(); action; action = action->next_item())
+        {
+            action->Seek(target, time);
+        }
+        return;
+    }
+
+    // Find the action which is playing at this time
+    ActionPtr active;
+    Duration  start;
+    for (active = actions_.first_item(); active; active = active->next_item())
+    {
+        Duration total = active->GetTotalDuration();
+        if (total == InfiniteDuration || time < start + total || !active->next_item())
+            break;
+        start += total;
+    }
+
+    // Undo the actions after it in reverse order, so that they will be initialized again when reached
+    for (auto action = actions_.last_item(); action != active; action = action->prev_item())
+    {
+        if (action->GetStatus() != Status::NotStarted)
+        {
+            action->Seek(target, 0);
+            action->Reset();
+        }
+    }
+
+    // Apply the end state of the actions before it
+    Duration offset;
+    for (auto action = actions_.first_item(); action != active; action = action->next_item())
+    {
+        Duration total = action->GetTotalDuration();
+        action->Seek(target, total);
+        offset += total;
+    }
+
+    current_ = active;
+    if (current_)
+    {
+        current_->Seek(target, time - offset);
+    }
+}
+
 void ActionGroup::Add(ActionPtr action)
 {
     if (action)
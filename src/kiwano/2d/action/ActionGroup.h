@@ -61,6 +61,15 @@ public:
     /// @brief 获取所有动画
     ActionList const& GetActions() const;
 
+    /// \~chinese
+    /// @brief 是否同步执行
+    bool IsSyncMode() const;
+
+    /// \~chinese
+    /// @brief 获取动画组合单次循环的时长
+    /// @details 顺序执行时为所有动画总时长之和，同步执行时为其中最长的总时长
+    Duration GetDuration() const override;
+
     /// \~chinese
     /// @brief 获取该动画的拷贝对象
     ActionPtr Clone() const override;
@@ -74,6 +83,8 @@ protected:
 
     void Update(Actor* target, Duration dt) override;
 
+    void Sample(Actor* target, Duration time) override;
+
 private:
     bool       sync_;
     ActionPtr  current_;
@@ -87,4 +98,9 @@ inline ActionGroup::ActionList const& ActionGroup::GetActions() const
     return actions_;
 }
 
+inline bool ActionGroup::IsSyncMode() const
+{
+    return sync_;
+}
+
 }  // namespace kiwano
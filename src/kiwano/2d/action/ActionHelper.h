@@ -137,6 +137,22 @@ struct TweenHelper
         return (*this);
     }
 
+    /// \~chinese
+    /// @brief 设置缓动函数类型
+    inline TweenHelper& SetEaseType(EaseType type)
+    {
+        core->SetEaseType(type);
+        return (*this);
+    }
+
+    /// \~chinese
+    /// @brief 设置缓动曲线
+    inline TweenHelper& SetEaseCurve(EaseCurve const& curve)
+    {
+        core->SetEaseCurve(curve);
+        return (*this);
+    }
+
     /// \~chinese
     /// @brief 设置动画延迟
     inline TweenHelper& SetDelay(Duration delay)
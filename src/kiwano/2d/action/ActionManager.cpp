@@ -21,25 +21,49 @@
 #include <kiwano/2d/Actor.h>
 #include <kiwano/2d/action/ActionManager.h>
 #include <kiwano/core/Logger.h>
+#include <kiwano/core/Profiler.h>
 
 namespace kiwano
 {
+namespace
+{
+
+uint64_t total_ticked_count = 0;
+
+}  // namespace
+
 void ActionManager::UpdateActions(Actor* target, Duration dt)
 {
     if (actions_.empty() || !target)
         return;
 
+    uint32_t ticked = 0;
+
     ActionPtr next;
     for (auto action = actions_.first_item(); action; action = next)
     {
         next = action->next_item();
 
         if (action->IsRunning())
+        {
             action->UpdateStep(target, dt);
+            ++ticked;
+        }
 
         if (action->IsRemoveable())
             actions_.remove(action);
     }
+
+    total_ticked_count += ticked;
+
+    Profiler& profiler = Profiler::Instance();
+    if (profiler.IsEnabled())
+        profiler.IncreaseActionsTicked(ticked);
+}
+
+uint64_t ActionManager::GetTotalTickedCount()
+{
+    return total_ticked_count;
 }
 
 Action* ActionManager::AddAction(ActionPtr action)
@@ -68,6 +68,11 @@ public:
     /// @brief 获取所有动画
     Actions const& GetAllActions() const;
 
+    /// \~chinese
+    /// @brief 获取所有动画管理器累计更新动画的次数
+    /// @details 可用于判断一段时间内是否有动画正在播放
+    static uint64_t GetTotalTickedCount();
+
 protected:
     /// \~chinese
     /// @brief 更新动画
@@ -0,0 +1,450 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <algorithm>
+#include <kiwano/2d/Actor.h>
+#include <kiwano/2d/action/ActionDelay.h>
+#include <kiwano/2d/action/ActionGroup.h>
+#include <kiwano/2d/action/ActionProgram.h>
+
+namespace kiwano
+{
+namespace
+{
+
+inline float ToMilliseconds(Duration duration)
+{
+    return float(duration.Milliseconds());
+}
+
+bool ParseTween(Action* action, ActionInstruction& instruction)
+{
+    auto tween = dynamic_cast<ActionTween*>(action);
+    if (!tween || tween->GetEaseType() == EaseType::Custom)
+        return false;
+
+    instruction.opcode   = ActionOpcode::Tween;
+    instruction.duration = ToMilliseconds(tween->GetDuration());
+    instruction.ease     = tween->GetEaseCurve();
+
+    if (auto move_to = dynamic_cast<ActionMoveTo*>(action))
+    {
+        instruction.property = TweenProperty::Position;
+        instruction.relative = false;
+        instruction.value    = move_to->GetTargetPos();
+    }
+    else if (auto move_by = dynamic_cast<ActionMoveBy*>(action))
+    {
+        instruction.property = TweenProperty::Position;
+        instruction.relative = true;
+        instruction.value    = move_by->GetVector();
+    }
+    else if (auto scale_to = dynamic_cast<ActionScaleTo*>(action))
+    {
+        instruction.property = TweenProperty::Scale;
+        instruction.relative = false;
+        instruction.value    = scale_to->GetTargetScale();
+    }
+    else if (auto scale_by = dynamic_cast<ActionScaleBy*>(action))
+    {
+        instruction.property = TweenProperty::Scale;
+        instruction.relative = true;
+        instruction.value    = scale_by->GetScaleDelta();
+    }
+    else if (auto rotate_to = dynamic_cast<ActionRotateTo*>(action))
+    {
+        instruction.property = TweenProperty::Rotation;
+        instruction.relative = false;
+        instruction.value    = Vec2(rotate_to->GetTargetRotation(), 0.f);
+    }
+    else if (auto rotate_by = dynamic_cast<ActionRotateBy*>(action))
+    {
+        instruction.property = TweenProperty::Rotation;
+        instruction.relative = true;
+        instruction.value    = Vec2(rotate_by->GetRotationDelta(), 0.f);
+    }
+    else if (auto fade_to = dynamic_cast<ActionFadeTo*>(action))
+    {
+        instruction.property = TweenProperty::Opacity;
+        instruction.relative = false;
+        instruction.value    = Vec2(fade_to->GetTargetOpacity(), 0.f);
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+Vec2 GetTweenProperty(Actor* target, TweenProperty property)
+{
+    switch (property)
+    {
+    case TweenProperty::Position:
+        return target->GetPosition();
+    case TweenProperty::Scale:
+        return Vec2(target->GetScaleX(), target->GetScaleY());
+    case TweenProperty::Rotation:
+        return Vec2(target->GetRotation(), 0.f);
+    case TweenProperty::Opacity:
+        return Vec2(target->GetOpacity(), 0.f);
+    default:
+        return Vec2();
+    }
+}
+
+}  // namespace
+
+//-------------------------------------------------------
+// ActionProgram
+//-------------------------------------------------------
+
+ActionProgramPtr ActionProgram::Compile(ActionPtr action)
+{
+    if (!action)
+        return nullptr;
+
+    ActionProgramPtr ptr = new (std::nothrow) ActionProgram;
+    if (ptr)
+    {
+        if (!ptr->Emit(action.get(), 0.f))
+            return nullptr;
+
+        // Instructions starting at the same time keep the order of the action tree
+        std::stable_sort(ptr->instructions_.begin(), ptr->instructions_.end(),
+                         [](ActionInstruction const& lhs, ActionInstruction const& rhs) { return lhs.start < rhs.start; });
+
+        ptr->duration_ = ToMilliseconds(action->GetTotalDuration());
+    }
+    return ptr;
+}
+
+ActionProgram::ActionProgram()
+    : duration_(0.f)
+{
+}
+
+bool ActionProgram::Emit(Action* action, float offset)
+{
+    if (action->GetLoops() < 0 || action->GetDuration() == Action::InfiniteDuration)
+    {
+        KGE_ERROR(L"ActionProgram::Compile failed: Actions with infinite loops cannot be compiled");
+        return false;
+    }
+
+    const float start = offset + ToMilliseconds(action->GetDelay());
+    const int   loops = action->GetLoops();
+
+    ActionInstruction instruction = {};
+    if (dynamic_cast<ActionDelay*>(action))
+    {
+        // Delays only move the start time of the following instructions
+    }
+    else if (auto group = dynamic_cast<ActionGroup*>(action))
+    {
+        const float duration = ToMilliseconds(group->GetDuration());
+        const auto& actions  = group->GetActions();
+
+        for (int i = 0; i <= loops; ++i)
+        {
+            float child_offset = start + duration * i;
+            for (auto& child : actions)
+            {
+                if (!Emit(&child, child_offset))
+                    return false;
+
+                if (!group->IsSyncMode())
+                    child_offset += ToMilliseconds(child.GetTotalDuration());
+            }
+        }
+    }
+    else if (ParseTween(action, instruction))
+    {
+        for (int i = 0; i <= loops; ++i)
+        {
+            instruction.start = start + instruction.duration * i;
+            if (!Push(instruction))
+                return false;
+        }
+    }
+    else
+    {
+        // Fall back to the action itself, its delay and loops are handled by Action::Seek
+        ActionPtr prototype = action->Clone();
+        if (!prototype)
+        {
+            KGE_ERROR(L"ActionProgram::Compile failed: Action cannot be cloned");
+            return false;
+        }
+
+        prototype->SetDelay(action->GetDelay());
+        prototype->SetLoops(loops);
+
+        instruction.opcode   = ActionOpcode::Invoke;
+        instruction.index    = uint32_t(actions_.size());
+        instruction.start    = offset;
+        instruction.duration = ToMilliseconds(action->GetTotalDuration());
+        actions_.push_back(prototype);
+
+        if (!Push(instruction))
+            return false;
+    }
+    return EmitCallbacks(action, start, ToMilliseconds(action->GetDuration()));
+}
+
+bool ActionProgram::EmitCallbacks(Action* action, float start, float duration)
+{
+    ActionInstruction instruction = {};
+    instruction.opcode            = ActionOpcode::Callback;
+
+    const int loops = action->GetLoops();
+    if (auto callback = action->GetLoopDoneCallback())
+    {
+        instruction.index = uint32_t(callbacks_.size());
+        callbacks_.push_back(callback);
+
+        for (int i = 0; i <= loops; ++i)
+        {
+            instruction.start = start + duration * (i + 1);
+            if (!Push(instruction))
+                return false;
+        }
+    }
+
+    if (auto callback = action->GetDoneCallback())
+    {
+        instruction.index = uint32_t(callbacks_.size());
+        instruction.start = start + duration * (loops + 1);
+        callbacks_.push_back(callback);
+
+        if (!Push(instruction))
+            return false;
+    }
+    return true;
+}
+
+bool ActionProgram::Push(ActionInstruction const& instruction)
+{
+    if (instructions_.size() >= MaxInstructions)
+    {
+        KGE_ERROR(L"ActionProgram::Compile failed: Too many instructions");
+        return false;
+    }
+
+    instructions_.push_back(instruction);
+    return true;
+}
+
+//-------------------------------------------------------
+// ActionInterpreter
+//-------------------------------------------------------
+
+ActionInterpreter::ActionInterpreter(ActionProgramPtr program)
+    : program_(program)
+    , pc_(0)
+{
+}
+
+Duration ActionInterpreter::GetDuration() const
+{
+    return program_ ? program_->GetDuration() : Duration();
+}
+
+ActionPtr ActionInterpreter::Clone() const
+{
+    return new (std::nothrow) ActionInterpreter(program_);
+}
+
+void ActionInterpreter::Init(Actor* target)
+{
+    if (!program_)
+    {
+        Done();
+        return;
+    }
+
+    pc_ = 0;
+    slots_.clear();
+
+    // Cloned actions are kept between loops
+    while (actions_.size() < program_->GetActions().size())
+        actions_.push_back(nullptr);
+}
+
+void ActionInterpreter::Update(Actor* target, Duration dt)
+{
+    const float duration = ToMilliseconds(program_->GetDuration());
+    if (duration == 0.f)
+    {
+        Run(target, 0.f);
+        Complete(target);
+        return;
+    }
+
+    float loops_done = ToMilliseconds(GetElapsed() - GetDelay()) / duration;
+
+    while (GetLoopsDone() < static_cast<int>(loops_done) && !IsDone())
+    {
+        // Finish the current loop before restarting the program
+        Run(target, duration);
+        Complete(target);  // loops_done_++
+    }
+
+    if (!IsDone())
+    {
+        Run(target, (loops_done - static_cast<float>(GetLoopsDone())) * duration);
+    }
+}
+
+void ActionInterpreter::Run(Actor* target, float time)
+{
+    const auto& instructions = program_->GetInstructions();
+
+    for (;;)
+    {
+        // Find the first slot which ends before this time, slots must finish in time order,
+        // or a following tween may capture a stale start value
+        size_t finished = slots_.size();
+        float  end_time = time;
+        for (size_t i = 0; i < slots_.size(); ++i)
+        {
+            const ActionInstruction& instruction = instructions[slots_[i].instruction];
+
+            float end = instruction.start + instruction.duration;
+            if (end < end_time || (end == end_time && finished == slots_.size()))
+            {
+                finished = i;
+                end_time = end;
+            }
+        }
+
+        bool can_start = pc_ < instructions.size() && instructions[pc_].start <= time;
+        if (can_start && (finished == slots_.size() || instructions[pc_].start < end_time))
+        {
+            Slot slot        = {};
+            slot.instruction = uint32_t(pc_++);
+            Start(target, slot);
+            continue;
+        }
+
+        if (finished < slots_.size())
+        {
+            Step(target, slots_[finished], end_time);
+            slots_.erase(slots_.begin() + finished);
+            continue;
+        }
+        break;
+    }
+
+    for (auto& slot : slots_)
+    {
+        Step(target, slot, time);
+    }
+}
+
+void ActionInterpreter::Start(Actor* target, Slot& slot)
+{
+    const ActionInstruction& instruction = program_->GetInstructions()[slot.instruction];
+
+    switch (instruction.opcode)
+    {
+    case ActionOpcode::Tween:
+    {
+        Vec2 current = GetTweenProperty(target, instruction.property);
+
+        slot.start = slot.prev = current;
+        slot.delta             = instruction.relative ? instruction.value : (instruction.value - current);
+        slots_.push_back(slot);
+        break;
+    }
+    case ActionOpcode::Invoke:
+    {
+        ActionPtr& action = actions_[instruction.index];
+        if (!action)
+        {
+            ActionPtr prototype = program_->GetActions()[instruction.index];
+
+            action = prototype->Clone();
+            if (action)
+            {
+                action->SetDelay(prototype->GetDelay());
+                action->SetLoops(prototype->GetLoops());
+            }
+        }
+
+        if (action)
+        {
+            action->Reset();
+            slots_.push_back(slot);
+        }
+        break;
+    }
+    case ActionOpcode::Callback:
+        program_->GetCallbacks()[instruction.index](target);
+        break;
+    }
+}
+
+void ActionInterpreter::Step(Actor* target, Slot& slot, float time)
+{
+    const ActionInstruction& instruction = program_->GetInstructions()[slot.instruction];
+
+    const float local = time - instruction.start;
+    if (instruction.opcode == ActionOpcode::Invoke)
+    {
+        actions_[instruction.index]->Seek(target, Duration(long(local)));
+        return;
+    }
+
+    float percent = (instruction.duration > 0.f) ? std::min(local / instruction.duration, 1.f) : 1.f;
+    percent       = instruction.ease(percent);
+
+    switch (instruction.property)
+    {
+    case TweenProperty::Position:
+    {
+        // Follow the movement caused by others, the same as ActionMoveBy does
+        slot.start += target->GetPosition() - slot.prev;
+        slot.prev = slot.start + slot.delta * percent;
+        target->SetPosition(slot.prev);
+        break;
+    }
+    case TweenProperty::Scale:
+        target->SetScale(slot.start + slot.delta * percent);
+        break;
+    case TweenProperty::Rotation:
+    {
+        float rotation = slot.start.x + slot.delta.x * percent;
+        if (rotation > 360.f)
+            rotation -= 360.f;
+
+        target->SetRotation(rotation);
+        break;
+    }
+    case TweenProperty::Opacity:
+        target->SetOpacity(slot.start.x + slot.delta.x * percent);
+        break;
+    default:
+        break;
+    }
+}
+
+}  // namespace kiwano
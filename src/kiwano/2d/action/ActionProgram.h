@@ -0,0 +1,203 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+#include <kiwano/2d/action/Action.h>
+#include <kiwano/2d/action/ActionTween.h>
+#include <kiwano/core/Logger.h>
+
+namespace kiwano
+{
+KGE_DECLARE_SMART_PTR(ActionProgram);
+KGE_DECLARE_SMART_PTR(ActionInterpreter);
+
+/**
+ * \addtogroup Actions
+ * @{
+ */
+
+/// \~chinese
+/// @brief 动画指令操作码
+enum class ActionOpcode : uint8_t
+{
+    Tween,     ///< 补间角色属性
+    Invoke,    ///< 执行无法编译的动画
+    Callback,  ///< 调用回调函数
+};
+
+/// \~chinese
+/// @brief 动画指令
+struct ActionInstruction
+{
+    ActionOpcode  opcode;    ///< 操作码
+    TweenProperty property;  ///< 补间属性
+    bool          relative;  ///< 补间值是否是相对值
+    uint32_t      index;     ///< 动画或回调函数的下标
+    float         start;     ///< 开始时间（毫秒）
+    float         duration;  ///< 持续时间（毫秒）
+    Vec2          value;     ///< 补间的变化值或目标值，单值属性仅使用 x 分量
+    EaseCurve     ease;      ///< 补间的缓动曲线
+};
+
+/// \~chinese
+/// @brief 动画程序
+/// @details 将嵌套的顺序动画组合、同步动画组合、延时、循环和补间动画展开为按开始时间排序的指令数组。
+/// 程序创建完成后是不可变的，可以被任意多个 ActionInterpreter 共享
+/// @see ActionInterpreter
+class KGE_API ActionProgram : public virtual ObjectBase
+{
+public:
+    /// \~chinese
+    /// @brief 编译动画
+    /// @details 缓动函数类型为 EaseType::Custom 的补间动画和其他无法识别的动画会被编译为 Invoke 指令，
+    /// 在执行时克隆并通过 Action::Seek 驱动。包含永久循环的动画无法被编译，
+    /// 需要永久循环时请设置 ActionInterpreter 的循环次数
+    /// @param action 动画
+    /// @return 编译失败时返回空指针
+    static ActionProgramPtr Compile(ActionPtr action);
+
+    ActionProgram();
+
+    /// \~chinese
+    /// @brief 获取程序时长
+    Duration GetDuration() const;
+
+    /// \~chinese
+    /// @brief 获取所有指令
+    Vector<ActionInstruction> const& GetInstructions() const;
+
+    /// \~chinese
+    /// @brief 获取 Invoke 指令执行的动画
+    Vector<ActionPtr> const& GetActions() const;
+
+    /// \~chinese
+    /// @brief 获取 Callback 指令调用的回调函数
+    Vector<Action::DoneCallback> const& GetCallbacks() const;
+
+    /// \~chinese
+    /// @brief 最大指令数量，展开循环后超出时编译失败
+    static const size_t MaxInstructions = 65536;
+
+private:
+    bool Emit(Action* action, float offset);
+
+    bool EmitCallbacks(Action* action, float start, float duration);
+
+    bool Push(ActionInstruction const& instruction);
+
+private:
+    float                        duration_;
+    Vector<ActionInstruction>    instructions_;
+    Vector<ActionPtr>            actions_;
+    Vector<Action::DoneCallback> callbacks_;
+};
+
+/// \~chinese
+/// @brief 动画解释器
+/// @details 按时间顺序执行动画程序中的指令，每个实例只保存程序计数器和正在执行的指令的状态
+class KGE_API ActionInterpreter : public Action
+{
+public:
+    /// \~chinese
+    /// @brief 构造动画解释器
+    /// @param program 动画程序
+    ActionInterpreter(ActionProgramPtr program);
+
+    /// \~chinese
+    /// @brief 获取动画程序
+    ActionProgramPtr GetProgram() const;
+
+    /// \~chinese
+    /// @brief 获取程序时长
+    Duration GetDuration() const override;
+
+    /// \~chinese
+    /// @brief 获取该动画的拷贝对象
+    ActionPtr Clone() const override;
+
+    /// \~chinese
+    /// @brief 获取该动画的倒转
+    ActionPtr Reverse() const override
+    {
+        KGE_ERROR(L"Reverse() not supported in ActionInterpreter");
+        return nullptr;
+    }
+
+protected:
+    void Init(Actor* target) override;
+
+    void Update(Actor* target, Duration dt) override;
+
+    /// \~chinese
+    /// @brief 执行指令直到指定时间
+    /// @param time 当前循环内的时间（毫秒）
+    void Run(Actor* target, float time);
+
+private:
+    /// \~chinese
+    /// @brief 正在执行的指令
+    struct Slot
+    {
+        uint32_t instruction;
+        Vec2     start;
+        Vec2     delta;
+        Vec2     prev;
+    };
+
+    void Start(Actor* target, Slot& slot);
+
+    void Step(Actor* target, Slot& slot, float time);
+
+private:
+    ActionProgramPtr  program_;
+    size_t            pc_;
+    Vector<Slot>      slots_;
+    Vector<ActionPtr> actions_;
+};
+
+/** @} */
+
+inline Duration ActionProgram::GetDuration() const
+{
+    return Duration(long(duration_));
+}
+
+inline Vector<ActionInstruction> const& ActionProgram::GetInstructions() const
+{
+    return instructions_;
+}
+
+inline Vector<ActionPtr> const& ActionProgram::GetActions() const
+{
+    return actions_;
+}
+
+inline Vector<Action::DoneCallback> const& ActionProgram::GetCallbacks() const
+{
+    return callbacks_;
+}
+
+inline ActionProgramPtr ActionInterpreter::GetProgram() const
+{
+    return program_;
+}
+
+}  // namespace kiwano
@@ -18,7 +18,6 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
-#include <functional>
 #include <kiwano/2d/Actor.h>
 #include <kiwano/2d/action/ActionTween.h>
 
@@ -28,62 +27,37 @@ namespace kiwano
 // Ease Functions
 //-------------------------------------------------------
 
-inline EaseFunc MakeEaseIn(float rate)
-{
-    return std::bind(math::EaseIn, std::placeholders::_1, rate);
-}
-inline EaseFunc MakeEaseOut(float rate)
-{
-    return std::bind(math::EaseOut, std::placeholders::_1, rate);
-}
-inline EaseFunc MakeEaseInOut(float rate)
-{
-    return std::bind(math::EaseInOut, std::placeholders::_1, rate);
-}
-inline EaseFunc MakeEaseElasticIn(float period)
-{
-    return std::bind(math::EaseElasticIn, std::placeholders::_1, period);
-}
-inline EaseFunc MakeEaseElasticOut(float period)
-{
-    return std::bind(math::EaseElasticOut, std::placeholders::_1, period);
-}
-inline EaseFunc MakeEaseElasticInOut(float period)
-{
-    return std::bind(math::EaseElasticInOut, std::placeholders::_1, period);
-}
-
-KGE_API EaseFunc Ease::Linear       = math::Linear;
-KGE_API EaseFunc Ease::EaseIn       = MakeEaseIn(2.f);
-KGE_API EaseFunc Ease::EaseOut      = MakeEaseOut(2.f);
-KGE_API EaseFunc Ease::EaseInOut    = MakeEaseInOut(2.f);
-KGE_API EaseFunc Ease::ExpoIn       = math::EaseExponentialIn;
-KGE_API EaseFunc Ease::ExpoOut      = math::EaseExponentialOut;
-KGE_API EaseFunc Ease::ExpoInOut    = math::EaseExponentialInOut;
-KGE_API EaseFunc Ease::BounceIn     = math::EaseBounceIn;
-KGE_API EaseFunc Ease::BounceOut    = math::EaseBounceOut;
-KGE_API EaseFunc Ease::BounceInOut  = math::EaseBounceInOut;
-KGE_API EaseFunc Ease::ElasticIn    = MakeEaseElasticIn(0.3f);
-KGE_API EaseFunc Ease::ElasticOut   = MakeEaseElasticOut(0.3f);
-KGE_API EaseFunc Ease::ElasticInOut = MakeEaseElasticInOut(0.3f);
-KGE_API EaseFunc Ease::SineIn       = math::EaseSineIn;
-KGE_API EaseFunc Ease::SineOut      = math::EaseSineOut;
-KGE_API EaseFunc Ease::SineInOut    = math::EaseSineInOut;
-KGE_API EaseFunc Ease::BackIn       = math::EaseBackIn;
-KGE_API EaseFunc Ease::BackOut      = math::EaseBackOut;
-KGE_API EaseFunc Ease::BackInOut    = math::EaseBackInOut;
-KGE_API EaseFunc Ease::QuadIn       = math::EaseQuadIn;
-KGE_API EaseFunc Ease::QuadOut      = math::EaseQuadOut;
-KGE_API EaseFunc Ease::QuadInOut    = math::EaseQuadInOut;
-KGE_API EaseFunc Ease::CubicIn      = math::EaseCubicIn;
-KGE_API EaseFunc Ease::CubicOut     = math::EaseCubicOut;
-KGE_API EaseFunc Ease::CubicInOut   = math::EaseCubicInOut;
-KGE_API EaseFunc Ease::QuartIn      = math::EaseQuartIn;
-KGE_API EaseFunc Ease::QuartOut     = math::EaseQuartOut;
-KGE_API EaseFunc Ease::QuartInOut   = math::EaseQuartInOut;
-KGE_API EaseFunc Ease::QuintIn      = math::EaseQuintIn;
-KGE_API EaseFunc Ease::QuintOut     = math::EaseQuintOut;
-KGE_API EaseFunc Ease::QuintInOut   = math::EaseQuintInOut;
+KGE_API EaseFunc Ease::Linear       = EaseCurve(EaseType::Linear);
+KGE_API EaseFunc Ease::EaseIn       = EaseCurve(EaseType::EaseIn);
+KGE_API EaseFunc Ease::EaseOut      = EaseCurve(EaseType::EaseOut);
+KGE_API EaseFunc Ease::EaseInOut    = EaseCurve(EaseType::EaseInOut);
+KGE_API EaseFunc Ease::ExpoIn       = EaseCurve(EaseType::ExpoIn);
+KGE_API EaseFunc Ease::ExpoOut      = EaseCurve(EaseType::ExpoOut);
+KGE_API EaseFunc Ease::ExpoInOut    = EaseCurve(EaseType::ExpoInOut);
+KGE_API EaseFunc Ease::BounceIn     = EaseCurve(EaseType::BounceIn);
+KGE_API EaseFunc Ease::BounceOut    = EaseCurve(EaseType::BounceOut);
+KGE_API EaseFunc Ease::BounceInOut  = EaseCurve(EaseType::BounceInOut);
+KGE_API EaseFunc Ease::ElasticIn    = EaseCurve(EaseType::ElasticIn);
+KGE_API EaseFunc Ease::ElasticOut   = EaseCurve(EaseType::ElasticOut);
+KGE_API EaseFunc Ease::ElasticInOut = EaseCurve(EaseType::ElasticInOut);
+KGE_API EaseFunc Ease::SineIn       = EaseCurve(EaseType::SineIn);
+KGE_API EaseFunc Ease::SineOut      = EaseCurve(EaseType::SineOut);
+KGE_API EaseFunc Ease::SineInOut    = EaseCurve(EaseType::SineInOut);
+KGE_API EaseFunc Ease::BackIn       = EaseCurve(EaseType::BackIn);
+KGE_API EaseFunc Ease::BackOut      = EaseCurve(EaseType::BackOut);
+KGE_API EaseFunc Ease::BackInOut    = EaseCurve(EaseType::BackInOut);
+KGE_API EaseFunc Ease::QuadIn       = EaseCurve(EaseType::QuadIn);
+KGE_API EaseFunc Ease::QuadOut      = EaseCurve(EaseType::QuadOut);
+KGE_API EaseFunc Ease::QuadInOut    = EaseCurve(EaseType::QuadInOut);
+KGE_API EaseFunc Ease::CubicIn      = EaseCurve(EaseType::CubicIn);
+KGE_API EaseFunc Ease::CubicOut     = EaseCurve(EaseType::CubicOut);
+KGE_API EaseFunc Ease::CubicInOut   = EaseCurve(EaseType::CubicInOut);
+KGE_API EaseFunc Ease::QuartIn      = EaseCurve(EaseType::QuartIn);
+KGE_API EaseFunc Ease::QuartOut     = EaseCurve(EaseType::QuartOut);
+KGE_API EaseFunc Ease::QuartInOut   = EaseCurve(EaseType::QuartInOut);
+KGE_API EaseFunc Ease::QuintIn      = EaseCurve(EaseType::QuintIn);
+KGE_API EaseFunc Ease::QuintOut     = EaseCurve(EaseType::QuintOut);
+KGE_API EaseFunc Ease::QuintInOut   = EaseCurve(EaseType::QuintInOut);
 
 //-------------------------------------------------------
 // ActionTween
@@ -91,6 +65,7 @@ KGE_API EaseFunc Ease::QuintInOut   = math::EaseQuintInOut;
 
 ActionTween::ActionTween()
     : dur_()
+    , ease_curve_()
     , ease_func_(nullptr)
 {
 }
@@ -103,7 +78,45 @@ ActionTween::ActionTween(Duration duration, EaseFunc func)
 
 void ActionTween::SetEaseFunc(EaseFunc const& func)
 {
-    ease_func_ = func;
+    if (func && func.GetCurve().type != EaseType::Custom)
+    {
+        // Functions wrapping a curve keep the fast paths
+        SetEaseCurve(func.GetCurve());
+        return;
+    }
+
+    ease_func_  = func;
+    ease_curve_ = EaseCurve(func ? EaseType::Custom : EaseType::Linear);
+}
+
+EaseType ActionTween::GetEaseType() const
+{
+    return ease_curve_.type;
+}
+
+void ActionTween::SetEaseType(EaseType type)
+{
+    SetEaseCurve(EaseCurve(type));
+}
+
+EaseCurve const& ActionTween::GetEaseCurve() const
+{
+    return ease_curve_;
+}
+
+void ActionTween::SetEaseCurve(EaseCurve const& curve)
+{
+    if (curve.type == EaseType::Custom)
+    {
+        KGE_ERROR(L"Custom ease type must be set by SetEaseFunc()");
+        return;
+    }
+
+    ease_curve_ = curve;
+    if (curve.type == EaseType::Linear)
+        ease_func_ = nullptr;
+    else
+        ease_func_ = curve;
 }
 
 EaseFunc const& ActionTween::GetEaseFunc() const
@@ -132,13 +145,28 @@ void ActionTween::Update(Actor* target, Duration dt)
 
         while (GetLoopsDone() < static_cast<int>(loops_done))
         {
+            // Finish the loop exactly, the next loop is initialized from its end state
+            UpdateEased(target, 1.f);
             Complete(target);  // loops_done_++
         }
 
         percent = (GetStatus() == Status::Done) ? 1.f : (loops_done - static_cast<float>(GetLoopsDone()));
     }
 
-    if (ease_func_)
+    UpdateEased(target, percent);
+}
+
+void ActionTween::Sample(Actor* target, Duration time)
+{
+    float percent = dur_.IsZero() ? 1.f : std::min(time / dur_, 1.f);
+    UpdateEased(target, percent);
+}
+
+void ActionTween::UpdateEased(Actor* target, float percent)
+{
+    if (ease_curve_.type != EaseType::Custom)
+        percent = ease_curve_(percent);
+    else if (ease_func_)
         percent = ease_func_(percent);
 
     UpdateTween(target, percent);
@@ -149,6 +177,20 @@ void ActionTween::SetDuration(Duration duration)
     dur_ = duration;
 }
 
+TweenProperty ActionTween::GetTweenValues(Vec2& start, Vec2& delta) const
+{
+    return TweenProperty::None;
+}
+
+ActionPtr ActionTween::DoClone(ActionTween* to) const
+{
+    if (to)
+    {
+        to->ease_curve_ = ease_curve_;
+    }
+    return to;
+}
+
 //-------------------------------------------------------
 // Move Action
 //-------------------------------------------------------
@@ -167,6 +209,13 @@ void ActionMoveBy::Init(Actor* target)
     }
 }
 
+bool ActionMoveBy::InitLoop(Actor* target, int loop)
+{
+    // Every loop starts where the previous one ended
+    start_pos_ = start_pos_ + delta_pos_ * float(loop - GetInitLoop());
+    return true;
+}
+
 void ActionMoveBy::UpdateTween(Actor* target, float percent)
 {
     Point diff = target->GetPosition() - prev_pos_;
@@ -180,12 +229,24 @@ void ActionMoveBy::UpdateTween(Actor* target, float percent)
 
 ActionPtr ActionMoveBy::Clone() const
 {
-    return new (std::nothrow) ActionMoveBy(GetDuration(), delta_pos_, GetEaseFunc());
+    return DoClone(new (std::nothrow) ActionMoveBy(GetDuration(), delta_pos_, GetEaseFunc()));
+}
+
+TweenProperty ActionMoveBy::GetTweenValues(Vec2& start, Vec2& delta) const
+{
+    start = start_pos_;
+    delta = delta_pos_;
+    return TweenProperty::Position;
 }
 
 ActionPtr ActionMoveBy::Reverse() const
 {
-    return new (std::nothrow) ActionMoveBy(GetDuration(), -delta_pos_, GetEaseFunc());
+    return DoClone(new (std::nothrow) ActionMoveBy(GetDuration(), -delta_pos_, GetEaseFunc()));
+}
+
+Vec2 ActionMoveBy::GetVector() const
+{
+    return delta_pos_;
 }
 
 ActionMoveTo::ActionMoveTo(Duration duration, Point const& pos, EaseFunc func)
@@ -196,15 +257,30 @@ ActionMoveTo::ActionMoveTo(Duration duration, Point const& pos, EaseFunc func)
 
 ActionPtr ActionMoveTo::Clone() const
 {
-    return new (std::nothrow) ActionMoveTo(GetDuration(), end_pos_, GetEaseFunc());
+    return DoClone(new (std::nothrow) ActionMoveTo(GetDuration(), end_pos_, GetEaseFunc()));
+}
+
+Point ActionMoveTo::GetTargetPos() const
+{
+    return end_pos_;
 }
 
 void ActionMoveTo::Init(Actor* target)
 {
     ActionMoveBy::Init(target);
+    if (GetInitLoop() == 0)
+        origin_pos_ = start_pos_;
     delta_pos_ = end_pos_ - start_pos_;
 }
 
+bool ActionMoveTo::InitLoop(Actor* target, int loop)
+{
+    // Loops after the first one start at the destination
+    start_pos_ = (loop == 0) ? origin_pos_ : end_pos_;
+    delta_pos_ = end_pos_ - start_pos_;
+    return true;
+}
+
 //-------------------------------------------------------
 // Jump Action
 //-------------------------------------------------------
@@ -219,12 +295,12 @@ ActionJumpBy::ActionJumpBy(Duration duration, Vec2 const& vec, float height, int
 
 ActionPtr ActionJumpBy::Clone() const
 {
-    return new (std::nothrow) ActionJumpBy(GetDuration(), delta_pos_, height_, jumps_, GetEaseFunc());
+    return DoClone(new (std::nothrow) ActionJumpBy(GetDuration(), delta_pos_, height_, jumps_, GetEaseFunc()));
 }
 
 ActionPtr ActionJumpBy::Reverse() const
 {
-    return new (std::nothrow) ActionJumpBy(GetDuration(), -delta_pos_, height_, jumps_, GetEaseFunc());
+    return DoClone(new (std::nothrow) ActionJumpBy(GetDuration(), -delta_pos_, height_, jumps_, GetEaseFunc()));
 }
 
 void ActionJumpBy::Init(Actor* target)
@@ -235,6 +311,12 @@ void ActionJumpBy::Init(Actor* target)
     }
 }
 
+bool ActionJumpBy::InitLoop(Actor* target, int loop)
+{
+    start_pos_ = start_pos_ + delta_pos_ * float(loop - GetInitLoop());
+    return true;
+}
+
 void ActionJumpBy::UpdateTween(Actor* target, float percent)
 {
     float frac = fmod(percent * jumps_, 1.f);
@@ -259,15 +341,24 @@ ActionJumpTo::ActionJumpTo(Duration duration, Point const& pos, float height, in
 
 ActionPtr ActionJumpTo::Clone() const
 {
-    return new (std::nothrow) ActionJumpTo(GetDuration(), end_pos_, height_, jumps_, GetEaseFunc());
+    return DoClone(new (std::nothrow) ActionJumpTo(GetDuration(), end_pos_, height_, jumps_, GetEaseFunc()));
 }
 
 void ActionJumpTo::Init(Actor* target)
 {
     ActionJumpBy::Init(target);
+    if (GetInitLoop() == 0)
+        origin_pos_ = start_pos_;
     delta_pos_ = end_pos_ - start_pos_;
 }
 
+bool ActionJumpTo::InitLoop(Actor* target, int loop)
+{
+    start_pos_ = (loop == 0) ? origin_pos_ : end_pos_;
+    delta_pos_ = end_pos_ - start_pos_;
+    return true;
+}
+
 //-------------------------------------------------------
 // Scale Action
 //-------------------------------------------------------
@@ -290,6 +381,14 @@ void ActionScaleBy::Init(Actor* target)
     }
 }
 
+bool ActionScaleBy::InitLoop(Actor* target, int loop)
+{
+    const float loops = float(loop - GetInitLoop());
+    start_scale_x_ += delta_x_ * loops;
+    start_scale_y_ += delta_y_ * loops;
+    return true;
+}
+
 void ActionScaleBy::UpdateTween(Actor* target, float percent)
 {
     target->SetScale(Vec2{ start_scale_x_ + delta_x_ * percent, start_scale_y_ + delta_y_ * percent });
@@ -297,16 +396,30 @@ void ActionScaleBy::UpdateTween(Actor* target, float percent)
 
 ActionPtr ActionScaleBy::Clone() const
 {
-    return new (std::nothrow) ActionScaleBy(GetDuration(), delta_x_, delta_y_, GetEaseFunc());
+    return DoClone(new (std::nothrow) ActionScaleBy(GetDuration(), delta_x_, delta_y_, GetEaseFunc()));
+}
+
+TweenProperty ActionScaleBy::GetTweenValues(Vec2& start, Vec2& delta) const
+{
+    start = Vec2{ start_scale_x_, start_scale_y_ };
+    delta = Vec2{ delta_x_, delta_y_ };
+    return TweenProperty::Scale;
 }
 
 ActionPtr ActionScaleBy::Reverse() const
 {
-    return new (std::nothrow) ActionScaleBy(GetDuration(), -delta_x_, -delta_y_, GetEaseFunc());
+    return DoClone(new (std::nothrow) ActionScaleBy(GetDuration(), -delta_x_, -delta_y_, GetEaseFunc()));
+}
+
+Vec2 ActionScaleBy::GetScaleDelta() const
+{
+    return Vec2{ delta_x_, delta_y_ };
 }
 
 ActionScaleTo::ActionScaleTo(Duration duration, float scale_x, float scale_y, EaseFunc func)
     : ActionScaleBy(duration, 0, 0, func)
+    , origin_scale_x_(0.f)
+    , origin_scale_y_(0.f)
 {
     end_scale_x_ = scale_x;
     end_scale_y_ = scale_y;
@@ -314,22 +427,42 @@ ActionScaleTo::ActionScaleTo(Duration duration, float scale_x, float scale_y, Ea
 
 ActionPtr ActionScaleTo::Clone() const
 {
-    return new (std::nothrow) ActionScaleTo(GetDuration(), end_scale_x_, end_scale_y_, GetEaseFunc());
+    return DoClone(new (std::nothrow) ActionScaleTo(GetDuration(), end_scale_x_, end_scale_y_, GetEaseFunc()));
+}
+
+Vec2 ActionScaleTo::GetTargetScale() const
+{
+    return Vec2{ end_scale_x_, end_scale_y_ };
 }
 
 void ActionScaleTo::Init(Actor* target)
 {
     ActionScaleBy::Init(target);
+    if (GetInitLoop() == 0)
+    {
+        origin_scale_x_ = start_scale_x_;
+        origin_scale_y_ = start_scale_y_;
+    }
     delta_x_ = end_scale_x_ - start_scale_x_;
     delta_y_ = end_scale_y_ - start_scale_y_;
 }
 
+bool ActionScaleTo::InitLoop(Actor* target, int loop)
+{
+    start_scale_x_ = (loop == 0) ? origin_scale_x_ : end_scale_x_;
+    start_scale_y_ = (loop == 0) ? origin_scale_y_ : end_scale_y_;
+    delta_x_       = end_scale_x_ - start_scale_x_;
+    delta_y_       = end_scale_y_ - start_scale_y_;
+    return true;
+}
+
 //-------------------------------------------------------
 // Opacity Action
 //-------------------------------------------------------
 
 ActionFadeTo::ActionFadeTo(Duration duration, float opacity, EaseFunc func)
     : ActionTween(duration, func)
+    , origin_val_(0.f)
     , delta_val_(0.f)
     , start_val_(0.f)
     , end_val_(opacity)
@@ -342,9 +475,19 @@ void ActionFadeTo::Init(Actor* target)
     {
         start_val_ = target->GetOpacity();
         delta_val_ = end_val_ - start_val_;
+
+        if (GetInitLoop() == 0)
+            origin_val_ = start_val_;
     }
 }
 
+bool ActionFadeTo::InitLoop(Actor* target, int loop)
+{
+    start_val_ = (loop == 0) ? origin_val_ : end_val_;
+    delta_val_ = end_val_ - start_val_;
+    return true;
+}
+
 void ActionFadeTo::UpdateTween(Actor* target, float percent)
 {
     target->SetOpacity(start_val_ + delta_val_ * percent);
@@ -352,7 +495,19 @@ void ActionFadeTo::UpdateTween(Actor* target, float percent)
 
 ActionPtr ActionFadeTo::Clone() const
 {
-    return new (std::nothrow) ActionFadeTo(GetDuration(), end_val_, GetEaseFunc());
+    return DoClone(new (std::nothrow) ActionFadeTo(GetDuration(), end_val_, GetEaseFunc()));
+}
+
+TweenProperty ActionFadeTo::GetTweenValues(Vec2& start, Vec2& delta) const
+{
+    start = Vec2{ start_val_, 0.f };
+    delta = Vec2{ delta_val_, 0.f };
+    return TweenProperty::Opacity;
+}
+
+float ActionFadeTo::GetTargetOpacity() const
+{
+    return end_val_;
 }
 
 ActionFadeIn::ActionFadeIn(Duration duration, EaseFunc func)
@@ -384,6 +539,12 @@ void ActionRotateBy::Init(Actor* target)
     }
 }
 
+bool ActionRotateBy::InitLoop(Actor* target, int loop)
+{
+    start_val_ += delta_val_ * float(loop - GetInitLoop());
+    return true;
+}
+
 void ActionRotateBy::UpdateTween(Actor* target, float percent)
 {
     float rotation = start_val_ + delta_val_ * percent;
@@ -395,31 +556,58 @@ void ActionRotateBy::UpdateTween(Actor* target, float percent)
 
 ActionPtr ActionRotateBy::Clone() const
 {
-    return new (std::nothrow) ActionRotateBy(GetDuration(), delta_val_, GetEaseFunc());
+    return DoClone(new (std::nothrow) ActionRotateBy(GetDuration(), delta_val_, GetEaseFunc()));
+}
+
+TweenProperty ActionRotateBy::GetTweenValues(Vec2& start, Vec2& delta) const
+{
+    start = Vec2{ start_val_, 0.f };
+    delta = Vec2{ delta_val_, 0.f };
+    return TweenProperty::Rotation;
 }
 
 ActionPtr ActionRotateBy::Reverse() const
 {
-    return new (std::nothrow) ActionRotateBy(GetDuration(), -delta_val_, GetEaseFunc());
+    return DoClone(new (std::nothrow) ActionRotateBy(GetDuration(), -delta_val_, GetEaseFunc()));
+}
+
+float ActionRotateBy::GetRotationDelta() const
+{
+    return delta_val_;
 }
 
 ActionRotateTo::ActionRotateTo(Duration duration, float rotation, EaseFunc func)
     : ActionRotateBy(duration, 0, func)
+    , origin_val_(0.f)
 {
     end_val_ = rotation;
 }
 
 ActionPtr ActionRotateTo::Clone() const
 {
-    return new (std::nothrow) ActionRotateTo(GetDuration(), end_val_, GetEaseFunc());
+    return DoClone(new (std::nothrow) ActionRotateTo(GetDuration(), end_val_, GetEaseFunc()));
+}
+
+float ActionRotateTo::GetTargetRotation() const
+{
+    return end_val_;
 }
 
 void ActionRotateTo::Init(Actor* target)
 {
     ActionRotateBy::Init(target);
+    if (GetInitLoop() == 0)
+        origin_val_ = start_val_;
     delta_val_ = end_val_ - start_val_;
 }
 
+bool ActionRotateTo::InitLoop(Actor* target, int loop)
+{
+    start_val_ = (loop == 0) ? origin_val_ : end_val_;
+    delta_val_ = end_val_ - start_val_;
+    return true;
+}
+
 //-------------------------------------------------------
 // ActionCustom
 //-------------------------------------------------------
@@ -441,6 +629,12 @@ void ActionCustom::Init(Actor* target)
         this->Done();
 }
 
+bool ActionCustom::InitLoop(Actor* target, int loop)
+{
+    // The tween function does not depend on the state of the target
+    return true;
+}
+
 void ActionCustom::UpdateTween(Actor* target, float percent)
 {
     if (tween_func_)
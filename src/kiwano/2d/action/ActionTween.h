@@ -20,13 +20,63 @@
 
 #pragma once
 #include <kiwano/2d/action/Action.h>
+#include <kiwano/2d/action/EaseCurve.h>
 #include <kiwano/core/Logger.h>
 
 namespace kiwano
 {
 /// \~chinese
 /// @brief 缓动函数
-using EaseFunc = Function<float(float)>;
+/// @details 由缓动曲线构造的缓动函数会保留曲线信息，设置到补间动画上时按缓动曲线处理，不会被视为自定义缓动函数
+class EaseFunc : public Function<float(float)>
+{
+public:
+    EaseFunc();
+
+    EaseFunc(std::nullptr_t);
+
+    EaseFunc(EaseCurve const& curve);
+
+    template <typename _Ty, typename _Decay = typename std::decay<_Ty>::type,
+              typename = typename std::enable_if<!std::is_same<_Decay, EaseFunc>::value
+                                                 && !std::is_same<_Decay, EaseCurve>::value
+                                                 && std::is_constructible<Function<float(float)>, _Ty>::value,
+                                                 int>::type>
+    EaseFunc(_Ty func)
+        : Function<float(float)>(std::move(func))
+        , curve_(EaseType::Custom)
+    {
+    }
+
+    /// \~chinese
+    /// @brief 获取缓动曲线
+    /// @details 不是由缓动曲线构造的缓动函数，其曲线类型为 EaseType::Custom
+    EaseCurve const& GetCurve() const;
+
+private:
+    EaseCurve curve_;
+};
+
+inline EaseFunc::EaseFunc()
+    : curve_(EaseType::Custom)
+{
+}
+
+inline EaseFunc::EaseFunc(std::nullptr_t)
+    : curve_(EaseType::Custom)
+{
+}
+
+inline EaseFunc::EaseFunc(EaseCurve const& curve)
+    : Function<float(float)>(curve)
+    , curve_(curve)
+{
+}
+
+inline EaseCurve const& EaseFunc::GetCurve() const
+{
+    return curve_;
+}
 
 /// \~chinese
 /// @brief 缓动函数枚举
@@ -66,6 +116,17 @@ struct Ease
     static KGE_API EaseFunc SineInOut;
 };
 
+/// \~chinese
+/// @brief 补间动画改变的角色属性
+enum class TweenProperty
+{
+    None,      ///< 不支持批量更新
+    Position,  ///< 坐标
+    Scale,     ///< 缩放
+    Rotation,  ///< 旋转角度
+    Opacity,   ///< 透明度
+};
+
 KGE_DECLARE_SMART_PTR(ActionTween);
 KGE_DECLARE_SMART_PTR(ActionMoveBy);
 KGE_DECLARE_SMART_PTR(ActionMoveTo);
@@ -89,6 +150,8 @@ KGE_DECLARE_SMART_PTR(ActionCustom);
 /// @brief 补间动画
 class KGE_API ActionTween : public Action
 {
+    friend class TweenSystem;
+
 public:
     ActionTween();
 
@@ -100,7 +163,7 @@ public:
 
     /// \~chinese
     /// @brief 获取动画时长
-    Duration GetDuration() const;
+    Duration GetDuration() const override;
 
     /// \~chinese
     /// @brief 设置动画时长
@@ -112,16 +175,51 @@ public:
 
     /// \~chinese
     /// @brief 设置动画速度缓动函数
+    /// @details Ease 中的缓动函数和由缓动曲线构造的缓动函数等同于调用 SetEaseCurve
     void SetEaseFunc(EaseFunc const& func);
 
+    /// \~chinese
+    /// @brief 获取缓动函数类型
+    EaseType GetEaseType() const;
+
+    /// \~chinese
+    /// @brief 设置缓动函数类型，使用默认参数
+    void SetEaseType(EaseType type);
+
+    /// \~chinese
+    /// @brief 获取缓动曲线
+    /// @details 通过 SetEaseFunc 设置的自定义缓动函数，其曲线类型为 EaseType::Custom
+    EaseCurve const& GetEaseCurve() const;
+
+    /// \~chinese
+    /// @brief 设置缓动曲线
+    /// @details 使用缓动曲线时，每帧直接计算缓动值而不经过类型擦除的函数调用，
+    /// 并且可以被 TweenSystem 分组批量计算
+    void SetEaseCurve(EaseCurve const& curve);
+
 protected:
     void Update(Actor* target, Duration dt) override;
 
+    void Sample(Actor* target, Duration time) override;
+
     virtual void UpdateTween(Actor* target, float percent) = 0;
 
+    /// \~chinese
+    /// @brief 获取补间改变的属性及其起始值和变化值，用于批量更新
+    /// @return 不支持批量更新时返回 TweenProperty::None
+    virtual TweenProperty GetTweenValues(Vec2& start, Vec2& delta) const;
+
+    /// \~chinese
+    /// @brief 将缓动函数类型复制到克隆的动画
+    ActionPtr DoClone(ActionTween* to) const;
+
 private:
-    Duration dur_;
-    EaseFunc ease_func_;
+    void UpdateEased(Actor* target, float percent);
+
+private:
+    Duration  dur_;
+    EaseCurve ease_curve_;
+    EaseFunc  ease_func_;
 };
 
 /// \~chinese
@@ -144,11 +242,19 @@ public:
     /// @brief 获取该动画的倒转
     ActionPtr Reverse() const override;
 
+    /// \~chinese
+    /// @brief 获取移动向量
+    Vec2 GetVector() const;
+
 protected:
     void Init(Actor* target) override;
 
+    bool InitLoop(Actor* target, int loop) override;
+
     void UpdateTween(Actor* target, float percent) override;
 
+    TweenProperty GetTweenValues(Vec2& start, Vec2& delta) const override;
+
 protected:
     Point start_pos_;
     Point prev_pos_;
@@ -171,6 +277,10 @@ public:
     /// @brief 获取该动画的拷贝对象
     ActionPtr Clone() const override;
 
+    /// \~chinese
+    /// @brief 获取目的坐标
+    Point GetTargetPos() const;
+
     /// \~chinese
     /// @brief 获取该动画的倒转
     virtual ActionPtr Reverse() const override
@@ -182,7 +292,10 @@ public:
 protected:
     void Init(Actor* target) override;
 
+    bool InitLoop(Actor* target, int loop) override;
+
 private:
+    Point origin_pos_;
     Point end_pos_;
 };
 
@@ -211,6 +324,8 @@ public:
 protected:
     void Init(Actor* target) override;
 
+    bool InitLoop(Actor* target, int loop) override;
+
     void UpdateTween(Actor* target, float percent) override;
 
 protected:
@@ -250,7 +365,10 @@ public:
 protected:
     void Init(Actor* target) override;
 
+    bool InitLoop(Actor* target, int loop) override;
+
 private:
+    Point origin_pos_;
     Point end_pos_;
 };
 
@@ -275,11 +393,19 @@ public:
     /// @brief 获取该动画的倒转
     ActionPtr Reverse() const override;
 
+    /// \~chinese
+    /// @brief 获取缩放相对变化值
+    Vec2 GetScaleDelta() const;
+
 protected:
     void Init(Actor* target) override;
 
+    bool InitLoop(Actor* target, int loop) override;
+
     void UpdateTween(Actor* target, float percent) override;
 
+    TweenProperty GetTweenValues(Vec2& start, Vec2& delta) const override;
+
 protected:
     float start_scale_x_;
     float start_scale_y_;
@@ -304,6 +430,10 @@ public:
     /// @brief 获取该动画的拷贝对象
     ActionPtr Clone() const override;
 
+    /// \~chinese
+    /// @brief 获取缩放目标值
+    Vec2 GetTargetScale() const;
+
     /// \~chinese
     /// @brief 获取该动画的倒转
     virtual ActionPtr Reverse() const override
@@ -315,7 +445,11 @@ public:
 protected:
     void Init(Actor* target) override;
 
+    bool InitLoop(Actor* target, int loop) override;
+
 private:
+    float origin_scale_x_;
+    float origin_scale_y_;
     float end_scale_x_;
     float end_scale_y_;
 };
@@ -336,6 +470,10 @@ public:
     /// @brief 获取该动画的拷贝对象
     ActionPtr Clone() const override;
 
+    /// \~chinese
+    /// @brief 获取目标透明度
+    float GetTargetOpacity() const;
+
     /// \~chinese
     /// @brief 获取该动画的倒转
     virtual ActionPtr Reverse() const override
@@ -347,9 +485,14 @@ public:
 protected:
     void Init(Actor* target) override;
 
+    bool InitLoop(Actor* target, int loop) override;
+
     void UpdateTween(Actor* target, float percent) override;
 
+    TweenProperty GetTweenValues(Vec2& start, Vec2& delta) const override;
+
 private:
+    float origin_val_;
     float start_val_;
     float delta_val_;
     float end_val_;
@@ -399,11 +542,19 @@ public:
     /// @brief 获取该动画的倒转
     ActionPtr Reverse() const override;
 
+    /// \~chinese
+    /// @brief 获取角度相对变化值
+    float GetRotationDelta() const;
+
 protected:
     void Init(Actor* target) override;
 
+    bool InitLoop(Actor* target, int loop) override;
+
     void UpdateTween(Actor* target, float percent) override;
 
+    TweenProperty GetTweenValues(Vec2& start, Vec2& delta) const override;
+
 protected:
     float start_val_;
     float delta_val_;
@@ -425,6 +576,10 @@ public:
     /// @brief 获取该动画的拷贝对象
     ActionPtr Clone() const override;
 
+    /// \~chinese
+    /// @brief 获取目标角度
+    float GetTargetRotation() const;
+
     /// \~chinese
     /// @brief 获取该动画的倒转
     virtual ActionPtr Reverse() const override
@@ -436,7 +591,10 @@ public:
 protected:
     void Init(Actor* target) override;
 
+    bool InitLoop(Actor* target, int loop) override;
+
 private:
+    float origin_val_;
     float end_val_;
 };
 
@@ -472,6 +630,8 @@ public:
 protected:
     void Init(Actor* target) override;
 
+    bool InitLoop(Actor* target, int loop) override;
+
     void UpdateTween(Actor* target, float percent) override;
 
 private:
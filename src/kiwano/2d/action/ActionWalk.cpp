@@ -67,7 +67,18 @@ void ActionWalk::Init(Actor* target)
     }
 
     start_pos_ = target->GetPosition();
-    length_    = path_->GetLength();
+
+    // The flattened path is cached by the shape and shared by all walkers
+    flattened_ = path_->GetFlattenedPath();
+    if (flattened_ && flattened_->IsValid())
+    {
+        length_ = flattened_->GetLength();
+    }
+    else
+    {
+        flattened_ = nullptr;
+        length_    = path_->GetLength();
+    }
 }
 
 void ActionWalk::UpdateTween(Actor* target, float percent)
@@ -75,7 +86,14 @@ void ActionWalk::UpdateTween(Actor* target, float percent)
     float distance = length_ * std::min(std::max((end_ - start_) * percent + start_, 0.f), 1.f);
 
     Point point, tangent;
-    if (path_->ComputePointAtLength(distance, point, tangent))
+
+    bool succeeded = false;
+    if (flattened_)
+        succeeded = flattened_->ComputePointAtLength(distance, point, tangent);
+    else
+        succeeded = path_->ComputePointAtLength(distance, point, tangent);
+
+    if (succeeded)
     {
         target->SetPosition(start_pos_ + point);
 
@@ -79,12 +79,13 @@ protected:
     void UpdateTween(Actor* target, float percent) override;
 
 private:
-    bool     rotating_;
-    float    start_;
-    float    end_;
-    float    length_;
-    Point    start_pos_;
-    ShapePtr path_;
+    bool             rotating_;
+    float            start_;
+    float            end_;
+    float            length_;
+    Point            start_pos_;
+    ShapePtr         path_;
+    FlattenedPathPtr flattened_;
 };
 
 /** @} */
@@ -66,6 +66,12 @@ void Animation::Init(Actor* target)
     }
 }
 
+bool Animation::InitLoop(Actor* target, int loop)
+{
+    // Every loop shows the same frames
+    return true;
+}
+
 void Animation::UpdateTween(Actor* target, float percent)
 {
     auto sprite_target = dynamic_cast<Sprite*>(target);
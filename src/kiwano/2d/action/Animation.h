@@ -67,6 +67,8 @@ public:
 protected:
     void Init(Actor* target) override;
 
+    bool InitLoop(Actor* target, int loop) override;
+
     void UpdateTween(Actor* target, float percent) override;
 
 private:
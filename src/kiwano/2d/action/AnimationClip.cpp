@@ -0,0 +1,528 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <fstream>
+#include <kiwano/2d/Sprite.h>
+#include <kiwano/2d/action/AnimationClip.h>
+#include <kiwano/platform/FileSystem.h>
+
+namespace kiwano
+{
+namespace
+{
+
+const char     clip_file_magic[4] = { 'K', 'G', 'A', 'C' };
+const uint32_t clip_file_version  = 1;
+
+// Indexed by EaseType
+const wchar_t* ease_type_names[] = {
+    L"Custom",
+    L"Linear",
+    L"EaseIn",
+    L"EaseOut",
+    L"EaseInOut",
+    L"ExpoIn",
+    L"ExpoOut",
+    L"ExpoInOut",
+    L"ElasticIn",
+    L"ElasticOut",
+    L"ElasticInOut",
+    L"BounceIn",
+    L"BounceOut",
+    L"BounceInOut",
+    L"BackIn",
+    L"BackOut",
+    L"BackInOut",
+    L"QuadIn",
+    L"QuadOut",
+    L"QuadInOut",
+    L"CubicIn",
+    L"CubicOut",
+    L"CubicInOut",
+    L"QuartIn",
+    L"QuartOut",
+    L"QuartInOut",
+    L"QuintIn",
+    L"QuintOut",
+    L"QuintInOut",
+    L"SineIn",
+    L"SineOut",
+    L"SineInOut",
+};
+
+const wchar_t* clip_property_names[] = {
+    L"position", L"scale", L"rotation", L"opacity", L"skew", L"frame",
+};
+
+#pragma pack(push, 4)
+
+struct ClipFileHeader
+{
+    char     magic[4];
+    uint32_t version;
+    uint32_t track_count;
+    uint32_t key_count;
+    float    duration;  // 毫秒，小于 0 表示使用最后一个关键帧的时间
+};
+
+struct ClipTrackRecord
+{
+    ClipProperty property;
+    uint8_t      reserved[3];
+    uint32_t     key_count;
+};
+
+struct ClipKeyRecord
+{
+    float    time;
+    float    value[2];
+    uint8_t  ease;
+    uint8_t  reserved[3];
+    float    ease_param;
+};
+
+#pragma pack(pop)
+
+bool ParseEaseType(String const& name, EaseType& type)
+{
+    for (size_t i = 0; i < sizeof(ease_type_names) / sizeof(ease_type_names[0]); ++i)
+    {
+        if (name == ease_type_names[i])
+        {
+            type = EaseType(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ParseClipProperty(String const& name, ClipProperty& property)
+{
+    for (size_t i = 0; i < sizeof(clip_property_names) / sizeof(clip_property_names[0]); ++i)
+    {
+        if (name == clip_property_names[i])
+        {
+            property = ClipProperty(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+//-------------------------------------------------------
+// AnimationClip
+//-------------------------------------------------------
+
+AnimationClipPtr AnimationClip::Load(String const& file_path)
+{
+    String full_path = FileSystem::Instance().GetFullPathForFile(file_path);
+    if (full_path.empty())
+    {
+        KGE_ERROR(L"AnimationClip::Load failed: File not found.");
+        return nullptr;
+    }
+
+    std::ifstream ifs(full_path.c_str(), std::ios::binary);
+    if (!ifs)
+    {
+        KGE_ERROR(L"AnimationClip::Load failed: Cannot open file %s", full_path.c_str());
+        return nullptr;
+    }
+
+    ClipFileHeader header;
+    if (!ifs.read(reinterpret_cast<char*>(&header), sizeof(header))
+        || ::memcmp(header.magic, clip_file_magic, sizeof(header.magic)) != 0)
+    {
+        KGE_ERROR(L"AnimationClip::Load failed: Invalid clip file");
+        return nullptr;
+    }
+
+    if (header.version != clip_file_version)
+    {
+        KGE_ERROR(L"AnimationClip::Load failed: Unsupported clip file version %u", header.version);
+        return nullptr;
+    }
+
+    // Check the record counts before allocating, a corrupted header must not cause a huge allocation
+    const std::streamoff data_begin = ifs.tellg();
+    ifs.seekg(0, std::ios::end);
+    const std::streamoff data_size = ifs.tellg() - data_begin;
+    ifs.seekg(data_begin, std::ios::beg);
+
+    const uint64_t required_size =
+        uint64_t(header.track_count) * sizeof(ClipTrackRecord) + uint64_t(header.key_count) * sizeof(ClipKeyRecord);
+    if (data_begin < 0 || data_size < 0 || required_size > uint64_t(data_size))
+    {
+        KGE_ERROR(L"AnimationClip::Load failed: Clip file is corrupted");
+        return nullptr;
+    }
+
+    // Vector(count) only reserves, size the arrays once with resize
+    Vector<ClipTrackRecord> tracks;
+    Vector<ClipKeyRecord>   keys;
+    tracks.resize(header.track_count);
+    keys.resize(header.key_count);
+
+    if ((!tracks.empty() && !ifs.read(reinterpret_cast<char*>(&tracks[0]), tracks.size_in_bytes()))
+        || (!keys.empty() && !ifs.read(reinterpret_cast<char*>(&keys[0]), keys.size_in_bytes())))
+    {
+        KGE_ERROR(L"AnimationClip::Load failed: Clip file is corrupted");
+        return nullptr;
+    }
+
+    AnimationClipPtr ptr = new (std::nothrow) AnimationClip;
+    if (ptr)
+    {
+        size_t next_key = 0;
+        for (const auto& track : tracks)
+        {
+            if (track.property > ClipProperty::Frame || next_key + track.key_count > keys.size())
+            {
+                KGE_ERROR(L"AnimationClip::Load failed: Clip file is corrupted");
+                return nullptr;
+            }
+
+            for (uint32_t i = 0; i < track.key_count; ++i)
+            {
+                const ClipKeyRecord& key = keys[next_key++];
+                if (key.ease > uint8_t(EaseType::SineInOut) || key.ease == uint8_t(EaseType::Custom))
+                {
+                    KGE_ERROR(L"AnimationClip::Load failed: Clip file is corrupted");
+                    return nullptr;
+                }
+
+                ptr->AddKey(track.property, Duration(long(key.time)), Vec2(key.value[0], key.value[1]),
+                            EaseCurve(EaseType(key.ease), key.ease_param));
+            }
+        }
+
+        if (header.duration >= 0.f)
+            ptr->SetDuration(Duration(long(header.duration)));
+    }
+    return ptr;
+}
+
+AnimationClipPtr AnimationClip::Load(Json const& json_data)
+{
+    AnimationClipPtr ptr = new (std::nothrow) AnimationClip;
+    if (!ptr)
+        return nullptr;
+
+    try
+    {
+        if (json_data.count(L"tracks"))
+        {
+            for (const auto& track : json_data[L"tracks"])
+            {
+                ClipProperty property;
+                if (!ParseClipProperty(track[L"property"].as_string(), property))
+                    throw std::runtime_error("unknown clip property");
+
+                for (const auto& key : track[L"keys"])
+                {
+                    Vec2        value;
+                    Json const& value_data = key[L"value"];
+                    if (value_data.is_array())
+                    {
+                        value.x = value_data[0].get<float>();
+                        value.y = value_data[1].get<float>();
+                    }
+                    else
+                    {
+                        value.x = value_data.get<float>();
+                    }
+
+                    EaseCurve ease;
+                    if (key.count(L"ease"))
+                    {
+                        EaseType type;
+                        if (!ParseEaseType(key[L"ease"].as_string(), type) || type == EaseType::Custom)
+                            throw std::runtime_error("unknown ease type");
+
+                        ease = EaseCurve(type);
+                        if (key.count(L"ease-param"))
+                            ease.param = key[L"ease-param"].get<float>();
+                    }
+
+                    ptr->AddKey(property, Duration(key[L"time"].as_int()), value, ease);
+                }
+            }
+        }
+
+        if (json_data.count(L"duration"))
+        {
+            ptr->SetDuration(Duration(json_data[L"duration"].as_int()));
+        }
+    }
+    catch (std::exception& e)
+    {
+        KGE_ERROR(L"AnimationClip::Load failed: JSON data is invalid. (%s)", oc::string_to_wide(e.what()).c_str());
+        return nullptr;
+    }
+    return ptr;
+}
+
+AnimationClip::AnimationClip()
+    : fixed_duration_(false)
+    , duration_(0.f)
+{
+}
+
+bool AnimationClip::Save(String const& file_path) const
+{
+    Vector<ClipTrackRecord> tracks;
+    Vector<ClipKeyRecord>   keys;
+    tracks.reserve(tracks_.size());
+
+    for (const auto& track : tracks_)
+    {
+        ClipTrackRecord track_record = {};
+        track_record.property        = track.property;
+        track_record.key_count       = uint32_t(track.keys.size());
+        tracks.push_back(track_record);
+
+        for (const auto& key : track.keys)
+        {
+            ClipKeyRecord key_record = {};
+            key_record.time          = key.time;
+            key_record.value[0]      = key.value.x;
+            key_record.value[1]      = key.value.y;
+            key_record.ease          = uint8_t(key.ease.type);
+            key_record.ease_param    = key.ease.param;
+            keys.push_back(key_record);
+        }
+    }
+
+    ClipFileHeader header;
+    ::memcpy(header.magic, clip_file_magic, sizeof(header.magic));
+    header.version     = clip_file_version;
+    header.track_count = uint32_t(tracks.size());
+    header.key_count   = uint32_t(keys.size());
+    header.duration    = fixed_duration_ ? duration_ : -1.f;
+
+    std::ofstream ofs(file_path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!ofs)
+    {
+        KGE_ERROR(L"AnimationClip::Save failed: Cannot open file %s", file_path.c_str());
+        return false;
+    }
+
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!tracks.empty())
+        ofs.write(reinterpret_cast<const char*>(&tracks[0]), tracks.size_in_bytes());
+    if (!keys.empty())
+        ofs.write(reinterpret_cast<const char*>(&keys[0]), keys.size_in_bytes());
+    return ofs.good();
+}
+
+void AnimationClip::AddKey(ClipProperty property, Duration time, Vec2 const& value, EaseCurve const& ease)
+{
+    ClipTrack* track = nullptr;
+    for (auto& t : tracks_)
+    {
+        if (t.property == property)
+        {
+            track = &t;
+            break;
+        }
+    }
+
+    if (!track)
+    {
+        ClipTrack new_track;
+        new_track.property = property;
+        tracks_.push_back(new_track);
+        track = &tracks_.back();
+    }
+
+    ClipKey key;
+    key.time  = float(time.Milliseconds());
+    key.value = value;
+    key.ease  = ease;
+
+    // Keep keys sorted by time
+    auto iter = track->keys.end();
+    while (iter != track->keys.begin() && (iter - 1)->time > key.time)
+        --iter;
+    track->keys.insert(iter, key);
+
+    if (!fixed_duration_)
+        duration_ = std::max(duration_, key.time);
+}
+
+void AnimationClip::AddKey(ClipProperty property, Duration time, float value, EaseCurve const& ease)
+{
+    AddKey(property, time, Vec2(value, 0.f), ease);
+}
+
+Duration AnimationClip::GetDuration() const
+{
+    return Duration(long(duration_));
+}
+
+void AnimationClip::SetDuration(Duration duration)
+{
+    fixed_duration_ = true;
+    duration_       = float(duration.Milliseconds());
+}
+
+Vec2 AnimationClip::Sample(size_t track, float time, size_t& cursor) const
+{
+    const ClipTrack&       clip_track = tracks_[track];
+    const Vector<ClipKey>& keys       = clip_track.keys;
+
+    const size_t count = keys.size();
+    if (count == 0)
+        return Vec2();
+
+    // Time usually moves forward, so the cursor only steps to the next segment
+    if (cursor >= count || keys[cursor].time > time)
+        cursor = 0;
+
+    while (cursor + 1 < count && keys[cursor + 1].time <= time)
+        ++cursor;
+
+    const ClipKey& key = keys[cursor];
+    if (cursor + 1 == count || time <= key.time || clip_track.property == ClipProperty::Frame)
+        return key.value;
+
+    const ClipKey& next    = keys[cursor + 1];
+    float          percent = key.ease((time - key.time) / (next.time - key.time));
+    return key.value + (next.value - key.value) * percent;
+}
+
+//-------------------------------------------------------
+// ActionClip
+//-------------------------------------------------------
+
+ActionClip::ActionClip(AnimationClipPtr clip)
+    : clip_(clip)
+    , frame_index_(-1)
+{
+}
+
+Duration ActionClip::GetDuration() const
+{
+    return clip_ ? clip_->GetDuration() : Duration();
+}
+
+ActionPtr ActionClip::Clone() const
+{
+    return new (std::nothrow) ActionClip(clip_);
+}
+
+void ActionClip::Init(Actor* target)
+{
+    if (!clip_)
+    {
+        Done();
+        return;
+    }
+
+    cursors_.assign(clip_->GetTracks().size(), 0);
+    frame_index_ = -1;
+}
+
+bool ActionClip::InitLoop(Actor* target, int loop)
+{
+    // Tracks hold absolute values, every loop samples the same curves
+    return true;
+}
+
+void ActionClip::Update(Actor* target, Duration dt)
+{
+    Duration duration = clip_->GetDuration();
+
+    float time = 0.f;
+    if (duration.IsZero())
+    {
+        Complete(target);
+    }
+    else
+    {
+        Duration elapsed    = GetElapsed() - GetDelay();
+        float    loops_done = elapsed / duration;
+
+        while (GetLoopsDone() < static_cast<int>(loops_done))
+        {
+            Complete(target);  // loops_done_++
+        }
+
+        if (GetStatus() == Status::Done)
+            time = float(duration.Milliseconds());
+        else
+            time = (loops_done - static_cast<float>(GetLoopsDone())) * float(duration.Milliseconds());
+    }
+
+    Apply(target, time);
+}
+
+void ActionClip::Sample(Actor* target, Duration time)
+{
+    Apply(target, float(time.Milliseconds()));
+}
+
+void ActionClip::Apply(Actor* target, float time)
+{
+    const auto& tracks = clip_->GetTracks();
+    for (size_t i = 0; i < tracks.size(); ++i)
+    {
+        Vec2 value = clip_->Sample(i, time, cursors_[i]);
+
+        switch (tracks[i].property)
+        {
+        case ClipProperty::Position:
+            target->SetPosition(value);
+            break;
+        case ClipProperty::Scale:
+            target->SetScale(value);
+            break;
+        case ClipProperty::Rotation:
+            target->SetRotation(value.x);
+            break;
+        case ClipProperty::Opacity:
+            target->SetOpacity(value.x);
+            break;
+        case ClipProperty::Skew:
+            target->SetSkew(value);
+            break;
+        case ClipProperty::Frame:
+        {
+            FrameSequencePtr frame_seq = clip_->GetFrameSequence();
+            Sprite*          sprite    = dynamic_cast<Sprite*>(target);
+            if (frame_seq && sprite && frame_seq->GetFramesCount())
+            {
+                int index = std::min(std::max(int(value.x), 0), int(frame_seq->GetFramesCount()) - 1);
+                if (index != frame_index_)
+                {
+                    frame_index_ = index;
+                    sprite->SetFrame(frame_seq->GetFrame(size_t(index)));
+                }
+            }
+            break;
+        }
+        }
+    }
+}
+
+}  // namespace kiwano
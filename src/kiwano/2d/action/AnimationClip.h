@@ -0,0 +1,212 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+#include <kiwano/2d/FrameSequence.h>
+#include <kiwano/2d/action/Action.h>
+#include <kiwano/2d/action/EaseCurve.h>
+#include <kiwano/core/Logger.h>
+
+namespace kiwano
+{
+KGE_DECLARE_SMART_PTR(AnimationClip);
+KGE_DECLARE_SMART_PTR(ActionClip);
+
+/**
+ * \addtogroup Actions
+ * @{
+ */
+
+/// \~chinese
+/// @brief 关键帧动画剪辑中的角色属性
+enum class ClipProperty : uint8_t
+{
+    Position,  ///< 坐标
+    Scale,     ///< 缩放
+    Rotation,  ///< 旋转角度
+    Opacity,   ///< 透明度
+    Skew,      ///< 错切角度
+    Frame,     ///< 序列帧下标
+};
+
+/// \~chinese
+/// @brief 关键帧
+struct ClipKey
+{
+    float     time;   ///< 时间（毫秒）
+    Vec2      value;  ///< 属性值，单值属性仅使用 x 分量
+    EaseCurve ease;   ///< 到下一个关键帧的缓动曲线
+};
+
+/// \~chinese
+/// @brief 关键帧轨道
+struct ClipTrack
+{
+    ClipProperty    property;  ///< 轨道属性
+    Vector<ClipKey> keys;      ///< 按时间排序的关键帧
+};
+
+/// \~chinese
+/// @brief 关键帧动画剪辑
+/// @details 剪辑由多条关键帧轨道组成，可以从 JSON 或二进制文件加载，也可以通过 ResourceCache 加载。
+/// 剪辑创建完成后是不可变的，可以被任意多个角色同时播放，每个播放实例只保存各轨道当前所在的关键帧区间
+/// @see ActionClip
+class KGE_API AnimationClip : public virtual ObjectBase
+{
+public:
+    /// \~chinese
+    /// @brief 从二进制文件加载剪辑
+    /// @param file_path 文件路径
+    static AnimationClipPtr Load(String const& file_path);
+
+    /// \~chinese
+    /// @brief 从 JSON 数据加载剪辑
+    /// @param json_data JSON 数据
+    static AnimationClipPtr Load(Json const& json_data);
+
+    AnimationClip();
+
+    /// \~chinese
+    /// @brief 保存剪辑到二进制文件
+    /// @param file_path 文件路径
+    bool Save(String const& file_path) const;
+
+    /// \~chinese
+    /// @brief 添加关键帧
+    /// @param property 角色属性
+    /// @param time 关键帧时间
+    /// @param value 属性值，单值属性仅使用 x 分量
+    /// @param ease 到下一个关键帧的缓动曲线
+    /// @note 剪辑开始播放后不应再修改
+    void AddKey(ClipProperty property, Duration time, Vec2 const& value, EaseCurve const& ease = EaseCurve());
+
+    /// \~chinese
+    /// @brief 添加单值属性的关键帧
+    void AddKey(ClipProperty property, Duration time, float value, EaseCurve const& ease = EaseCurve());
+
+    /// \~chinese
+    /// @brief 获取剪辑时长
+    Duration GetDuration() const;
+
+    /// \~chinese
+    /// @brief 设置剪辑时长
+    /// @details 默认为最后一个关键帧的时间
+    void SetDuration(Duration duration);
+
+    /// \~chinese
+    /// @brief 获取所有轨道
+    Vector<ClipTrack> const& GetTracks() const;
+
+    /// \~chinese
+    /// @brief 获取序列帧轨道使用的序列帧
+    FrameSequencePtr GetFrameSequence() const;
+
+    /// \~chinese
+    /// @brief 设置序列帧轨道使用的序列帧
+    void SetFrameSequence(FrameSequencePtr frame_seq);
+
+    /// \~chinese
+    /// @brief 采样轨道
+    /// @param track 轨道下标
+    /// @param time 时间（毫秒）
+    /// @param[in,out] cursor 轨道当前所在的关键帧下标，时间递增时采样的均摊复杂度为 O(1)
+    Vec2 Sample(size_t track, float time, size_t& cursor) const;
+
+private:
+    bool              fixed_duration_;
+    float             duration_;
+    Vector<ClipTrack> tracks_;
+    FrameSequencePtr  frame_seq_;
+};
+
+/// \~chinese
+/// @brief 关键帧动画
+/// @details 播放一个关键帧动画剪辑，多个动画可以共享同一个剪辑
+class KGE_API ActionClip : public Action
+{
+public:
+    /// \~chinese
+    /// @brief 构造关键帧动画
+    /// @param clip 关键帧动画剪辑
+    ActionClip(AnimationClipPtr clip);
+
+    /// \~chinese
+    /// @brief 获取关键帧动画剪辑
+    AnimationClipPtr GetClip() const;
+
+    /// \~chinese
+    /// @brief 获取剪辑时长
+    Duration GetDuration() const override;
+
+    /// \~chinese
+    /// @brief 获取该动画的拷贝对象
+    ActionPtr Clone() const override;
+
+    /// \~chinese
+    /// @brief 获取该动画的倒转
+    ActionPtr Reverse() const override
+    {
+        KGE_ERROR(L"Reverse() not supported in ActionClip");
+        return nullptr;
+    }
+
+protected:
+    void Init(Actor* target) override;
+
+    bool InitLoop(Actor* target, int loop) override;
+
+    void Update(Actor* target, Duration dt) override;
+
+    void Sample(Actor* target, Duration time) override;
+
+    /// \~chinese
+    /// @brief 将剪辑在指定时间的状态应用到角色上
+    void Apply(Actor* target, float time);
+
+private:
+    AnimationClipPtr clip_;
+    Vector<size_t>   cursors_;
+    int              frame_index_;
+};
+
+/** @} */
+
+inline Vector<ClipTrack> const& AnimationClip::GetTracks() const
+{
+    return tracks_;
+}
+
+inline FrameSequencePtr AnimationClip::GetFrameSequence() const
+{
+    return frame_seq_;
+}
+
+inline void AnimationClip::SetFrameSequence(FrameSequencePtr frame_seq)
+{
+    frame_seq_ = frame_seq;
+}
+
+inline AnimationClipPtr ActionClip::GetClip() const
+{
+    return clip_;
+}
+
+}  // namespace kiwano
@@ -0,0 +1,78 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <kiwano/2d/action/EaseCurve.h>
+#include <cstring>
+#include <mutex>
+
+namespace kiwano
+{
+
+bool EaseCurve::IsLookupTableSupported() const
+{
+    switch (type)
+    {
+    case EaseType::ElasticIn:
+    case EaseType::ElasticOut:
+    case EaseType::ElasticInOut:
+    case EaseType::BounceIn:
+    case EaseType::BounceOut:
+    case EaseType::BounceInOut:
+    case EaseType::BackIn:
+    case EaseType::BackOut:
+    case EaseType::BackInOut:
+        return true;
+    default:
+        return false;
+    }
+}
+
+EaseCurve& EaseCurve::UseLookupTable(bool enabled)
+{
+    table = nullptr;
+
+    if (!enabled || !IsLookupTableSupported())
+        return *this;
+
+    // Tables are shared by curves with the same type and parameter, and live until exit
+    static std::mutex                           tables_mutex;
+    static UnorderedMap<uint64_t, Vector<float>> tables;
+
+    uint32_t param_bits = 0;
+    std::memcpy(&param_bits, &param, sizeof(param_bits));
+    uint64_t key = (uint64_t(type) << 32) | param_bits;
+
+    std::lock_guard<std::mutex> lock(tables_mutex);
+
+    Vector<float>& samples = tables[key];
+    if (samples.empty())
+    {
+        samples.resize(table_size + 1);
+        for (int i = 0; i <= table_size; ++i)
+        {
+            samples[i] = Evaluate(type, param, float(i) / table_size);
+        }
+    }
+    table = samples.begin();
+    return *this;
+}
+
+}  // namespace kiwano
@@ -0,0 +1,459 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+#include <algorithm>
+#include <kiwano/core/Common.h>
+#include <kiwano/math/Math.h>
+
+namespace kiwano
+{
+
+/**
+ * \addtogroup Actions
+ * @{
+ */
+
+/// \~chinese
+/// @brief 缓动函数类型
+/// @details 除 Custom 外，每个类型对应 Ease 中的同名缓动函数
+enum class EaseType
+{
+    Custom,  ///< 自定义缓动函数
+    Linear,
+    EaseIn,
+    EaseOut,
+    EaseInOut,
+    ExpoIn,
+    ExpoOut,
+    ExpoInOut,
+    ElasticIn,
+    ElasticOut,
+    ElasticInOut,
+    BounceIn,
+    BounceOut,
+    BounceInOut,
+    BackIn,
+    BackOut,
+    BackInOut,
+    QuadIn,
+    QuadOut,
+    QuadInOut,
+    CubicIn,
+    CubicOut,
+    CubicInOut,
+    QuartIn,
+    QuartOut,
+    QuartInOut,
+    QuintIn,
+    QuintOut,
+    QuintInOut,
+    SineIn,
+    SineOut,
+    SineInOut,
+};
+
+/// \~chinese
+/// @brief 获取缓动函数的默认参数
+/// @details EaseIn、EaseOut、EaseInOut 的参数为速率，Elastic 缓动的参数为周期，其他缓动函数没有参数
+inline constexpr float GetEaseDefaultParam(EaseType type)
+{
+    return (type == EaseType::EaseIn || type == EaseType::EaseOut || type == EaseType::EaseInOut)
+               ? 2.f
+               : ((type == EaseType::ElasticIn || type == EaseType::ElasticOut || type == EaseType::ElasticInOut)
+                      ? 0.3f
+                      : 0.f);
+}
+
+/// \~chinese
+/// @brief 编译期缓动函数
+/// @details 缓动类型在编译期确定，调用时没有类型擦除，可以被编译器内联
+/// @code
+///   EaseFunctor<EaseType::QuadIn> ease;
+///   float value = ease(0.5f);
+/// @endcode
+template <EaseType _Type>
+struct EaseFunctor
+{
+    float param;  ///< 缓动参数
+
+    explicit EaseFunctor(float param = GetEaseDefaultParam(_Type))
+        : param(param)
+    {
+    }
+
+    float operator()(float step) const;
+};
+
+/// \~chinese
+/// @brief 缓动曲线
+/// @details 由缓动类型和参数组成，运行时以 switch 分派到对应的缓动函数，没有类型擦除和堆内存分配。
+/// 对于计算量较大的 Elastic、Bounce 和 Back 缓动，可以启用预计算的查找表
+struct KGE_API EaseCurve
+{
+    EaseType     type;   ///< 缓动类型
+    float        param;  ///< 缓动参数
+    const float* table;  ///< 查找表，为空时直接计算
+
+    /// \~chinese
+    /// @brief 查找表的采样区间数
+    static const int table_size = 256;
+
+    /// \~chinese
+    /// @brief 构造线性缓动曲线
+    EaseCurve();
+
+    /// \~chinese
+    /// @brief 构造缓动曲线，使用默认参数
+    EaseCurve(EaseType type);
+
+    /// \~chinese
+    /// @brief 构造缓动曲线
+    /// @param type 缓动类型
+    /// @param param 缓动参数
+    EaseCurve(EaseType type, float param);
+
+    /// \~chinese
+    /// @brief 是否支持查找表
+    /// @details 仅 Elastic、Bounce 和 Back 缓动支持查找表
+    bool IsLookupTableSupported() const;
+
+    /// \~chinese
+    /// @brief 启用或关闭查找表
+    /// @details 相同类型和参数的曲线共享同一张查找表，查找表在首次启用时生成
+    EaseCurve& UseLookupTable(bool enabled = true);
+
+    /// \~chinese
+    /// @brief 计算缓动值
+    /// @param step 进度（0.0 - 1.0）
+    float operator()(float step) const;
+
+    /// \~chinese
+    /// @brief 直接计算缓动值，不使用查找表
+    static float Evaluate(EaseType type, float param, float step);
+
+    bool operator==(EaseCurve const& rhs) const;
+
+    bool operator!=(EaseCurve const& rhs) const;
+};
+
+/** @} */
+
+template <>
+inline float EaseFunctor<EaseType::Linear>::operator()(float step) const
+{
+    return math::Linear(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::EaseIn>::operator()(float step) const
+{
+    return math::EaseIn(step, param);
+}
+
+template <>
+inline float EaseFunctor<EaseType::EaseOut>::operator()(float step) const
+{
+    return math::EaseOut(step, param);
+}
+
+template <>
+inline float EaseFunctor<EaseType::EaseInOut>::operator()(float step) const
+{
+    return math::EaseInOut(step, param);
+}
+
+template <>
+inline float EaseFunctor<EaseType::ExpoIn>::operator()(float step) const
+{
+    return math::EaseExponentialIn(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::ExpoOut>::operator()(float step) const
+{
+    return math::EaseExponentialOut(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::ExpoInOut>::operator()(float step) const
+{
+    return math::EaseExponentialInOut(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::ElasticIn>::operator()(float step) const
+{
+    return math::EaseElasticIn(step, param);
+}
+
+template <>
+inline float EaseFunctor<EaseType::ElasticOut>::operator()(float step) const
+{
+    return math::EaseElasticOut(step, param);
+}
+
+template <>
+inline float EaseFunctor<EaseType::ElasticInOut>::operator()(float step) const
+{
+    return math::EaseElasticInOut(step, param);
+}
+
+template <>
+inline float EaseFunctor<EaseType::BounceIn>::operator()(float step) const
+{
+    return math::EaseBounceIn(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::BounceOut>::operator()(float step) const
+{
+    return math::EaseBounceOut(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::BounceInOut>::operator()(float step) const
+{
+    return math::EaseBounceInOut(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::BackIn>::operator()(float step) const
+{
+    return math::EaseBackIn(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::BackOut>::operator()(float step) const
+{
+    return math::EaseBackOut(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::BackInOut>::operator()(float step) const
+{
+    return math::EaseBackInOut(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::QuadIn>::operator()(float step) const
+{
+    return math::EaseQuadIn(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::QuadOut>::operator()(float step) const
+{
+    return math::EaseQuadOut(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::QuadInOut>::operator()(float step) const
+{
+    return math::EaseQuadInOut(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::CubicIn>::operator()(float step) const
+{
+    return math::EaseCubicIn(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::CubicOut>::operator()(float step) const
+{
+    return math::EaseCubicOut(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::CubicInOut>::operator()(float step) const
+{
+    return math::EaseCubicInOut(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::QuartIn>::operator()(float step) const
+{
+    return math::EaseQuartIn(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::QuartOut>::operator()(float step) const
+{
+    return math::EaseQuartOut(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::QuartInOut>::operator()(float step) const
+{
+    return math::EaseQuartInOut(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::QuintIn>::operator()(float step) const
+{
+    return math::EaseQuintIn(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::QuintOut>::operator()(float step) const
+{
+    return math::EaseQuintOut(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::QuintInOut>::operator()(float step) const
+{
+    return math::EaseQuintInOut(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::SineIn>::operator()(float step) const
+{
+    return math::EaseSineIn(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::SineOut>::operator()(float step) const
+{
+    return math::EaseSineOut(step);
+}
+
+template <>
+inline float EaseFunctor<EaseType::SineInOut>::operator()(float step) const
+{
+    return math::EaseSineInOut(step);
+}
+
+inline EaseCurve::EaseCurve()
+    : type(EaseType::Linear)
+    , param(0.f)
+    , table(nullptr)
+{
+}
+
+inline EaseCurve::EaseCurve(EaseType type)
+    : type(type)
+    , param(GetEaseDefaultParam(type))
+    , table(nullptr)
+{
+}
+
+inline EaseCurve::EaseCurve(EaseType type, float param)
+    : type(type)
+    , param(param)
+    , table(nullptr)
+{
+}
+
+inline float EaseCurve::Evaluate(EaseType type, float param, float step)
+{
+    switch (type)
+    {
+    case EaseType::Linear:
+        return EaseFunctor<EaseType::Linear>(param)(step);
+    case EaseType::EaseIn:
+        return EaseFunctor<EaseType::EaseIn>(param)(step);
+    case EaseType::EaseOut:
+        return EaseFunctor<EaseType::EaseOut>(param)(step);
+    case EaseType::EaseInOut:
+        return EaseFunctor<EaseType::EaseInOut>(param)(step);
+    case EaseType::ExpoIn:
+        return EaseFunctor<EaseType::ExpoIn>(param)(step);
+    case EaseType::ExpoOut:
+        return EaseFunctor<EaseType::ExpoOut>(param)(step);
+    case EaseType::ExpoInOut:
+        return EaseFunctor<EaseType::ExpoInOut>(param)(step);
+    case EaseType::ElasticIn:
+        return EaseFunctor<EaseType::ElasticIn>(param)(step);
+    case EaseType::ElasticOut:
+        return EaseFunctor<EaseType::ElasticOut>(param)(step);
+    case EaseType::ElasticInOut:
+        return EaseFunctor<EaseType::ElasticInOut>(param)(step);
+    case EaseType::BounceIn:
+        return EaseFunctor<EaseType::BounceIn>(param)(step);
+    case EaseType::BounceOut:
+        return EaseFunctor<EaseType::BounceOut>(param)(step);
+    case EaseType::BounceInOut:
+        return EaseFunctor<EaseType::BounceInOut>(param)(step);
+    case EaseType::BackIn:
+        return EaseFunctor<EaseType::BackIn>(param)(step);
+    case EaseType::BackOut:
+        return EaseFunctor<EaseType::BackOut>(param)(step);
+    case EaseType::BackInOut:
+        return EaseFunctor<EaseType::BackInOut>(param)(step);
+    case EaseType::QuadIn:
+        return EaseFunctor<EaseType::QuadIn>(param)(step);
+    case EaseType::QuadOut:
+        return EaseFunctor<EaseType::QuadOut>(param)(step);
+    case EaseType::QuadInOut:
+        return EaseFunctor<EaseType::QuadInOut>(param)(step);
+    case EaseType::CubicIn:
+        return EaseFunctor<EaseType::CubicIn>(param)(step);
+    case EaseType::CubicOut:
+        return EaseFunctor<EaseType::CubicOut>(param)(step);
+    case EaseType::CubicInOut:
+        return EaseFunctor<EaseType::CubicInOut>(param)(step);
+    case EaseType::QuartIn:
+        return EaseFunctor<EaseType::QuartIn>(param)(step);
+    case EaseType::QuartOut:
+        return EaseFunctor<EaseType::QuartOut>(param)(step);
+    case EaseType::QuartInOut:
+        return EaseFunctor<EaseType::QuartInOut>(param)(step);
+    case EaseType::QuintIn:
+        return EaseFunctor<EaseType::QuintIn>(param)(step);
+    case EaseType::QuintOut:
+        return EaseFunctor<EaseType::QuintOut>(param)(step);
+    case EaseType::QuintInOut:
+        return EaseFunctor<EaseType::QuintInOut>(param)(step);
+    case EaseType::SineIn:
+        return EaseFunctor<EaseType::SineIn>(param)(step);
+    case EaseType::SineOut:
+        return EaseFunctor<EaseType::SineOut>(param)(step);
+    case EaseType::SineInOut:
+        return EaseFunctor<EaseType::SineInOut>(param)(step);
+    default:
+        return step;
+    }
+}
+
+inline float EaseCurve::operator()(float step) const
+{
+    if (table)
+    {
+        float pos   = std::min(std::max(step, 0.f), 1.f) * table_size;
+        int   index = std::min(static_cast<int>(pos), table_size - 1);
+        return table[index] + (table[index + 1] - table[index]) * (pos - index);
+    }
+    return Evaluate(type, param, step);
+}
+
+inline bool EaseCurve::operator==(EaseCurve const& rhs) const
+{
+    return type == rhs.type && param == rhs.param && table == rhs.table;
+}
+
+inline bool EaseCurve::operator!=(EaseCurve const& rhs) const
+{
+    return !(*this == rhs);
+}
+
+}  // namespace kiwano
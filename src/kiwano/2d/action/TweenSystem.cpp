@@ -0,0 +1,571 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <kiwano/2d/Stage.h>
+#include <kiwano/2d/action/TweenSystem.h>
+
+namespace kiwano
+{
+namespace
+{
+
+template <typename _Ty>
+inline void SwapRemove(Vector<_Ty>& vec, size_t index)
+{
+    if (index + 1 < vec.size())
+        vec[index] = vec.back();
+    vec.pop_back();
+}
+
+template <typename _Func>
+inline void EaseEach(float* values, size_t count, _Func func)
+{
+    for (size_t i = 0; i < count; ++i)
+        values[i] = func(values[i]);
+}
+
+void EaseValues(EaseCurve const& curve, float* values, size_t count)
+{
+    if (curve.table)
+    {
+        EaseEach(values, count, curve);
+        return;
+    }
+
+    switch (curve.type)
+    {
+    case EaseType::EaseIn:
+        EaseEach(values, count, EaseFunctor<EaseType::EaseIn>(curve.param));
+        break;
+    case EaseType::EaseOut:
+        EaseEach(values, count, EaseFunctor<EaseType::EaseOut>(curve.param));
+        break;
+    case EaseType::EaseInOut:
+        EaseEach(values, count, EaseFunctor<EaseType::EaseInOut>(curve.param));
+        break;
+    case EaseType::ExpoIn:
+        EaseEach(values, count, EaseFunctor<EaseType::ExpoIn>(curve.param));
+        break;
+    case EaseType::ExpoOut:
+        EaseEach(values, count, EaseFunctor<EaseType::ExpoOut>(curve.param));
+        break;
+    case EaseType::ExpoInOut:
+        EaseEach(values, count, EaseFunctor<EaseType::ExpoInOut>(curve.param));
+        break;
+    case EaseType::ElasticIn:
+        EaseEach(values, count, EaseFunctor<EaseType::ElasticIn>(curve.param));
+        break;
+    case EaseType::ElasticOut:
+        EaseEach(values, count, EaseFunctor<EaseType::ElasticOut>(curve.param));
+        break;
+    case EaseType::ElasticInOut:
+        EaseEach(values, count, EaseFunctor<EaseType::ElasticInOut>(curve.param));
+        break;
+    case EaseType::BounceIn:
+        EaseEach(values, count, EaseFunctor<EaseType::BounceIn>(curve.param));
+        break;
+    case EaseType::BounceOut:
+        EaseEach(values, count, EaseFunctor<EaseType::BounceOut>(curve.param));
+        break;
+    case EaseType::BounceInOut:
+        EaseEach(values, count, EaseFunctor<EaseType::BounceInOut>(curve.param));
+        break;
+    case EaseType::BackIn:
+        EaseEach(values, count, EaseFunctor<EaseType::BackIn>(curve.param));
+        break;
+    case EaseType::BackOut:
+        EaseEach(values, count, EaseFunctor<EaseType::BackOut>(curve.param));
+        break;
+    case EaseType::BackInOut:
+        EaseEach(values, count, EaseFunctor<EaseType::BackInOut>(curve.param));
+        break;
+    case EaseType::QuadIn:
+        EaseEach(values, count, EaseFunctor<EaseType::QuadIn>(curve.param));
+        break;
+    case EaseType::QuadOut:
+        EaseEach(values, count, EaseFunctor<EaseType::QuadOut>(curve.param));
+        break;
+    case EaseType::QuadInOut:
+        EaseEach(values, count, EaseFunctor<EaseType::QuadInOut>(curve.param));
+        break;
+    case EaseType::CubicIn:
+        EaseEach(values, count, EaseFunctor<EaseType::CubicIn>(curve.param));
+        break;
+    case EaseType::CubicOut:
+        EaseEach(values, count, EaseFunctor<EaseType::CubicOut>(curve.param));
+        break;
+    case EaseType::CubicInOut:
+        EaseEach(values, count, EaseFunctor<EaseType::CubicInOut>(curve.param));
+        break;
+    case EaseType::QuartIn:
+        EaseEach(values, count, EaseFunctor<EaseType::QuartIn>(curve.param));
+        break;
+    case EaseType::QuartOut:
+        EaseEach(values, count, EaseFunctor<EaseType::QuartOut>(curve.param));
+        break;
+    case EaseType::QuartInOut:
+        EaseEach(values, count, EaseFunctor<EaseType::QuartInOut>(curve.param));
+        break;
+    case EaseType::QuintIn:
+        EaseEach(values, count, EaseFunctor<EaseType::QuintIn>(curve.param));
+        break;
+    case EaseType::QuintOut:
+        EaseEach(values, count, EaseFunctor<EaseType::QuintOut>(curve.param));
+        break;
+    case EaseType::QuintInOut:
+        EaseEach(values, count, EaseFunctor<EaseType::QuintInOut>(curve.param));
+        break;
+    case EaseType::SineIn:
+        EaseEach(values, count, EaseFunctor<EaseType::SineIn>(curve.param));
+        break;
+    case EaseType::SineOut:
+        EaseEach(values, count, EaseFunctor<EaseType::SineOut>(curve.param));
+        break;
+    case EaseType::SineInOut:
+        EaseEach(values, count, EaseFunctor<EaseType::SineInOut>(curve.param));
+        break;
+    default:
+        break;
+    }
+}
+
+}  // namespace
+
+//-------------------------------------------------------
+// TweenSystem::Batch
+//-------------------------------------------------------
+
+size_t TweenSystem::Batch::Size() const
+{
+    return tweens.size();
+}
+
+void TweenSystem::Batch::Push(Actor* target, ActionTween* tween)
+{
+    Duration dur = tween->GetDuration();
+
+    tweens.push_back(tween);
+    targets.push_back(target);
+    elapsed.push_back(0.f);
+    delay.push_back(float(tween->GetDelay().Milliseconds()));
+    inv_duration.push_back(dur.IsZero() ? 0.f : 1.f / float(dur.Milliseconds()));
+    percent.push_back(0.f);
+    start_x.push_back(0.f);
+    start_y.push_back(0.f);
+    delta_x.push_back(0.f);
+    delta_y.push_back(0.f);
+    prev_x.push_back(0.f);
+    prev_y.push_back(0.f);
+    value_x.push_back(0.f);
+    value_y.push_back(0.f);
+    active.push_back(0);
+    done.push_back(0);
+
+    Reload(Size() - 1);
+}
+
+void TweenSystem::Batch::Reload(size_t index)
+{
+    Vec2 start, delta;
+    tweens[index]->GetTweenValues(start, delta);
+
+    start_x[index] = prev_x[index] = start.x;
+    start_y[index] = prev_y[index] = start.y;
+    delta_x[index]                 = delta.x;
+    delta_y[index]                 = delta.y;
+}
+
+void TweenSystem::Batch::Remove(size_t index)
+{
+    SwapRemove(tweens, index);
+    SwapRemove(targets, index);
+    SwapRemove(elapsed, index);
+    SwapRemove(delay, index);
+    SwapRemove(inv_duration, index);
+    SwapRemove(percent, index);
+    SwapRemove(start_x, index);
+    SwapRemove(start_y, index);
+    SwapRemove(delta_x, index);
+    SwapRemove(delta_y, index);
+    SwapRemove(prev_x, index);
+    SwapRemove(prev_y, index);
+    SwapRemove(value_x, index);
+    SwapRemove(value_y, index);
+    SwapRemove(active, index);
+    SwapRemove(done, index);
+}
+
+//-------------------------------------------------------
+// TweenSystem
+//-------------------------------------------------------
+
+TweenSystem::TweenSystem()
+    : updating_(false)
+    , ticked_count_(0)
+{
+}
+
+TweenSystem::~TweenSystem() {}
+
+bool TweenSystem::AddTween(Actor* target, ActionTweenPtr tween)
+{
+    KGE_ASSERT(target && tween && "AddTween failed, NULL pointer exception");
+
+    if (!target || !tween)
+        return false;
+
+    tween->Restart(target);
+
+    Vec2 start, delta;
+    if (tween->GetTweenValues(start, delta) == TweenProperty::None)
+    {
+        tween->Reset();
+        target->AddAction(tween);
+        return false;
+    }
+
+    tween->status_   = Action::Status::Started;
+    target->tweened_ = true;
+
+    if (updating_)
+    {
+        // Batches must not grow while they are being iterated
+        pending_.push_back(Entry{ target, tween });
+    }
+    else
+    {
+        GetBatch(tween->GetEaseCurve(), tween->GetTweenValues(start, delta)).Push(target, tween.get());
+    }
+    return true;
+}
+
+void TweenSystem::RemoveTweens(Actor* target)
+{
+    // Removed tweens are dropped on the next update, the target may be destroyed before that
+    for (auto& batch : batches_)
+    {
+        for (size_t i = 0; i < batch.Size(); ++i)
+        {
+            if (batch.targets[i] == target)
+            {
+                batch.tweens[i]->status_ = Action::Status::Removeable;
+                batch.targets[i]         = nullptr;
+            }
+        }
+    }
+
+    for (auto& entry : pending_)
+    {
+        if (entry.target == target)
+        {
+            entry.tween->status_ = Action::Status::Removeable;
+            entry.target         = nullptr;
+        }
+    }
+
+    for (auto& entry : finished_)
+    {
+        if (entry.target == target)
+            entry.target = nullptr;
+    }
+}
+
+void TweenSystem::Clear()
+{
+    if (updating_)
+    {
+        for (auto& batch : batches_)
+        {
+            for (auto& tween : batch.tweens)
+                tween->status_ = Action::Status::Removeable;
+        }
+    }
+    else
+    {
+        batches_.clear();
+    }
+    pending_.clear();
+}
+
+size_t TweenSystem::GetTweenCount() const
+{
+    size_t count = pending_.size();
+    for (const auto& batch : batches_)
+        count += batch.Size();
+    return count;
+}
+
+uint64_t TweenSystem::GetTotalTickedCount() const
+{
+    return ticked_count_;
+}
+
+void TweenSystem::Update(Duration dt, Stage* stage)
+{
+    if (!stage)
+        return;
+
+    updating_ = true;
+
+    const float delta = float(dt.Milliseconds());
+    for (auto& batch : batches_)
+    {
+        UpdateBatch(batch, delta, stage);
+    }
+
+    updating_ = false;
+
+    // Done callbacks may add or remove tweens, so they are invoked after all batches are updated
+    for (size_t i = 0; i < finished_.size(); ++i)
+    {
+        Entry& entry = finished_[i];
+        if (entry.target)
+            entry.tween->Finish(entry.target);
+        else
+            entry.tween->status_ = Action::Status::Removeable;
+    }
+    finished_.clear();
+
+    for (auto& entry : pending_)
+    {
+        if (entry.tween->IsRemoveable() || !entry.target)
+            continue;
+
+        Vec2 start, delta;
+        GetBatch(entry.tween->GetEaseCurve(), entry.tween->GetTweenValues(start, delta))
+            .Push(entry.target, entry.tween.get());
+    }
+    pending_.clear();
+}
+
+TweenSystem::Batch& TweenSystem::GetBatch(EaseCurve const& ease, TweenProperty property)
+{
+    for (auto& batch : batches_)
+    {
+        if (batch.ease == ease && batch.property == property)
+            return batch;
+    }
+
+    Batch batch;
+    batch.ease     = ease;
+    batch.property = property;
+    batches_.push_back(batch);
+    return batches_.back();
+}
+
+void TweenSystem::UpdateBatch(Batch& batch, float dt, Stage* stage)
+{
+    // Drop removed tweens and finish stopped ones
+    for (size_t i = batch.Size(); i > 0; --i)
+    {
+        ActionTween* tween = batch.tweens[i - 1].get();
+        if (tween->IsRemoveable() || !batch.targets[i - 1])
+        {
+            batch.Remove(i - 1);
+        }
+        else if (tween->IsDone() && batch.targets[i - 1]->GetStage() == stage)
+        {
+            finished_.push_back(Entry{ batch.targets[i - 1], batch.tweens[i - 1] });
+            batch.Remove(i - 1);
+        }
+    }
+
+    const size_t count = batch.Size();
+    if (count == 0)
+        return;
+
+    float*   elapsed      = batch.elapsed.begin();
+    float*   delay        = batch.delay.begin();
+    float*   inv_duration = batch.inv_duration.begin();
+    float*   percent      = batch.percent.begin();
+    uint8_t* active       = batch.active.begin();
+    uint8_t* done         = batch.done.begin();
+
+    // Advance time, paused tweens and tweens of actors outside the stage keep their progress,
+    // the same as actions added to the actors
+    for (size_t i = 0; i < count; ++i)
+    {
+        bool running = batch.tweens[i]->IsRunning() && batch.targets[i]->GetStage() == stage;
+        elapsed[i] += running ? dt : 0.f;
+        active[i] = running && elapsed[i] >= delay[i];
+        ticked_count_ += running ? 1 : 0;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        percent[i] = (elapsed[i] - delay[i]) * inv_duration[i];
+    }
+
+    // Loop completion is rare, handle it per tween
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (!active[i])
+            continue;
+
+        if (inv_duration[i] == 0.f)
+        {
+            ActionTween* tween = batch.tweens[i].get();
+            tween->Complete(batch.targets[i]);
+
+            percent[i] = 1.f;
+        }
+        else if (percent[i] >= 1.f)
+        {
+            ActionTween* tween = batch.tweens[i].get();
+            int          loops = static_cast<int>(percent[i]);
+
+            for (; loops > 0 && batch.targets[i] && !tween->IsDone(); --loops)
+            {
+                tween->Complete(batch.targets[i]);
+            }
+
+            // Keep only the progress of the current loop, so the elapsed time stays bounded
+            percent[i] = tween->IsDone() ? 1.f : (percent[i] - static_cast<int>(percent[i]));
+            elapsed[i] = delay[i] + percent[i] / inv_duration[i];
+        }
+        else
+        {
+            continue;
+        }
+
+        // Loop callbacks may remove the target
+        if (batch.targets[i])
+        {
+            batch.Reload(i);
+            done[i] = batch.tweens[i]->IsDone();
+        }
+        else
+        {
+            active[i] = 0;
+        }
+    }
+
+    ApplyEase(batch);
+
+    const float* start_x = batch.start_x.begin();
+    const float* start_y = batch.start_y.begin();
+    const float* delta_x = batch.delta_x.begin();
+    const float* delta_y = batch.delta_y.begin();
+    float*       value_x = batch.value_x.begin();
+    float*       value_y = batch.value_y.begin();
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        value_x[i] = start_x[i] + delta_x[i] * percent[i];
+        value_y[i] = start_y[i] + delta_y[i] * percent[i];
+    }
+
+    WriteBack(batch);
+
+    for (size_t i = count; i > 0; --i)
+    {
+        if (done[i - 1])
+        {
+            finished_.push_back(Entry{ batch.targets[i - 1], batch.tweens[i - 1] });
+            batch.Remove(i - 1);
+        }
+    }
+}
+
+void TweenSystem::ApplyEase(Batch& batch)
+{
+    const size_t count   = batch.Size();
+    float*       percent = batch.percent.begin();
+
+    if (batch.ease.type == EaseType::Custom)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            EaseFunc const& func = batch.tweens[i]->ease_func_;
+            if (func)
+                percent[i] = func(percent[i]);
+        }
+    }
+    else
+    {
+        EaseValues(batch.ease, percent, count);
+    }
+}
+
+void TweenSystem::WriteBack(Batch& batch)
+{
+    const size_t   count   = batch.Size();
+    const uint8_t* active  = batch.active.begin();
+    const float*   value_x = batch.value_x.begin();
+    const float*   value_y = batch.value_y.begin();
+
+    switch (batch.property)
+    {
+    case TweenProperty::Position:
+    {
+        // Follow the movement caused by others, the same as ActionMoveBy does
+        float*       start_x = batch.start_x.begin();
+        float*       start_y = batch.start_y.begin();
+        float*       prev_x  = batch.prev_x.begin();
+        float*       prev_y  = batch.prev_y.begin();
+        const float* delta_x = batch.delta_x.begin();
+        const float* delta_y = batch.delta_y.begin();
+        const float* percent = batch.percent.begin();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            Actor* target = batch.targets[i];
+            if (!active[i] || !target)
+                continue;
+
+            const Point& pos = target->GetPosition();
+
+            start_x[i] += pos.x - prev_x[i];
+            start_y[i] += pos.y - prev_y[i];
+            prev_x[i] = start_x[i] + delta_x[i] * percent[i];
+            prev_y[i] = start_y[i] + delta_y[i] * percent[i];
+
+            target->SetPosition(Point(prev_x[i], prev_y[i]));
+        }
+        break;
+    }
+    case TweenProperty::Scale:
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (active[i] && batch.targets[i])
+                batch.targets[i]->SetScale(Vec2{ value_x[i], value_y[i] });
+        }
+        break;
+    case TweenProperty::Rotation:
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (active[i] && batch.targets[i])
+                batch.targets[i]->SetRotation(value_x[i] > 360.f ? value_x[i] - 360.f : value_x[i]);
+        }
+        break;
+    case TweenProperty::Opacity:
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (active[i] && batch.targets[i])
+                batch.targets[i]->SetOpacity(value_x[i]);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+}  // namespace kiwano
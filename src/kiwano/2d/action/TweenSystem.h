@@ -0,0 +1,139 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+#include <kiwano/2d/action/ActionTween.h>
+#include <kiwano/core/Singleton.h>
+
+namespace kiwano
+{
+
+/**
+ * \addtogroup Actions
+ * @{
+ */
+
+/// \~chinese
+/// @brief 补间动画系统
+/// @details 集中更新大量补间动画。位移、缩放、旋转和透明度补间按缓动曲线和属性分组，
+/// 以数组结构（SoA）保存，每帧在紧凑的循环中统一计算进度、缓动和属性值，最后一次性写回角色，
+/// 避免逐个动画的虚函数调用和类型擦除的缓动函数调用
+/// @note 动画的延时、循环、暂停、停止和回调等行为与添加到角色上时一致，只有角色所在的舞台被更新时动画才会前进
+/// @note 补间动画系统不持有角色的引用，角色被销毁时它的补间动画会被自动移除
+class KGE_API TweenSystem : public Singleton<TweenSystem>
+{
+    friend Singleton<TweenSystem>;
+
+public:
+    /// \~chinese
+    /// @brief 添加补间动画
+    /// @param target 执行动画的角色
+    /// @param tween 补间动画
+    /// @return 不支持批量更新的补间动画（如跳跃、路径和自定义动画）会添加到角色上并返回 false
+    bool AddTween(Actor* target, ActionTweenPtr tween);
+
+    /// \~chinese
+    /// @brief 移除角色的所有补间动画
+    void RemoveTweens(Actor* target);
+
+    /// \~chinese
+    /// @brief 移除所有补间动画
+    void Clear();
+
+    /// \~chinese
+    /// @brief 获取补间动画数量
+    size_t GetTweenCount() const;
+
+    /// \~chinese
+    /// @brief 获取累计更新补间动画的次数
+    /// @details 暂停的补间动画和不在更新中的舞台上的补间动画不计入，可用于判断一段时间内是否有补间动画正在播放
+    /// @see ActionManager::GetTotalTickedCount
+    uint64_t GetTotalTickedCount() const;
+
+    /// \~chinese
+    /// @brief 更新舞台中角色的补间动画
+    /// @param dt 时间间隔
+    /// @param stage 正在更新的舞台，其他舞台和不在舞台中的角色的补间动画保持暂停
+    void Update(Duration dt, Stage* stage);
+
+private:
+    TweenSystem();
+
+    ~TweenSystem();
+
+    /// \~chinese
+    /// @brief 相同缓动函数类型、相同属性的补间动画
+    struct Batch
+    {
+        EaseCurve     ease;
+        TweenProperty property;
+
+        Vector<ActionTweenPtr> tweens;
+        Vector<Actor*>         targets;
+        Vector<float>          elapsed;
+        Vector<float>          delay;
+        Vector<float>          inv_duration;
+        Vector<float>          percent;
+        Vector<float>          start_x;
+        Vector<float>          start_y;
+        Vector<float>          delta_x;
+        Vector<float>          delta_y;
+        Vector<float>          prev_x;
+        Vector<float>          prev_y;
+        Vector<float>          value_x;
+        Vector<float>          value_y;
+        Vector<uint8_t>        active;
+        Vector<uint8_t>        done;
+
+        size_t Size() const;
+
+        void Push(Actor* target, ActionTween* tween);
+
+        void Reload(size_t index);
+
+        void Remove(size_t index);
+    };
+
+    struct Entry
+    {
+        Actor*         target;
+        ActionTweenPtr tween;
+    };
+
+    Batch& GetBatch(EaseCurve const& ease, TweenProperty property);
+
+    void UpdateBatch(Batch& batch, float dt, Stage* stage);
+
+    void ApplyEase(Batch& batch);
+
+    void WriteBack(Batch& batch);
+
+private:
+    bool          updating_;
+    uint64_t      ticked_count_;
+    Vector<Batch> batches_;
+    Vector<Entry> pending_;
+    Vector<Entry> finished_;
+};
+
+/** @} */
+
+}  // namespace kiwano
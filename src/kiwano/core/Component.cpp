@@ -19,6 +19,7 @@
 // THE SOFTWARE.
 
 #include <kiwano/core/Component.h>
+#include <kiwano/core/Logger.h>
 
 #define KGE_DEFINE_COMPONENT_FLAG(OFFSET) (0x01 << (OFFSET % 32))
 
@@ -44,10 +45,49 @@ RenderComponent::RenderComponent()
 }
 
 UpdateComponent::UpdateComponent()
+    : parallel_(false)
+    , reads_(0)
+    , writes_(0)
+    , update_start_(0)
+    , update_cost_(0)
 {
     flag_ |= flag;
 }
 
+void UpdateComponent::AddUpdateDependency(UpdateComponent* component)
+{
+    if (component && component != this && !dependencies_.contains(component))
+    {
+        if (component->DependsOn(this))
+        {
+            KGE_ERROR(L"Update dependency rejected: it would form a cycle");
+            return;
+        }
+        dependencies_.push_back(component);
+    }
+}
+
+bool UpdateComponent::DependsOn(UpdateComponent* component) const
+{
+    for (auto dependency : dependencies_)
+    {
+        if (dependency == component || dependency->DependsOn(component))
+            return true;
+    }
+    return false;
+}
+
+bool UpdateComponent::CanUpdateWith(UpdateComponent* other) const
+{
+    if (!parallel_ || !other->parallel_)
+        return false;
+
+    if (dependencies_.contains(other) || other->dependencies_.contains(const_cast<UpdateComponent*>(this)))
+        return false;
+
+    return !(writes_ & (other->reads_ | other->writes_)) && !(other->writes_ & reads_);
+}
+
 EventComponent::EventComponent()
 {
     flag_ |= flag;
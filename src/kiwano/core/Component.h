@@ -26,6 +26,7 @@ namespace kiwano
 {
 class RenderContext;
 class Event;
+class Application;
 
 /**
  * \~chinese
@@ -80,9 +81,13 @@ public:
 /**
  * \~chinese
  * @brief 更新支持组件
+ * @details 默认情况下所有组件按添加顺序在主线程中依次更新。允许并行更新的组件之间若没有依赖关系，
+ * 且读写的数据没有冲突，其 OnUpdate 可能在工作线程中同时执行
  */
 class KGE_API UpdateComponent : public virtual ComponentBase
 {
+    friend class Application;
+
 public:
     /// \~chinese
     /// @brief 更新前
@@ -97,10 +102,56 @@ public:
     /// @brief 更新后
     virtual void AfterUpdate() {}
 
+    /// \~chinese
+    /// @brief 是否允许并行更新
+    bool IsParallelUpdateEnabled() const;
+
+    /// \~chinese
+    /// @brief 设置是否允许并行更新，默认不允许
+    /// @details 只有 OnUpdate 函数会被并行执行，BeforeUpdate 和 AfterUpdate 总是在主线程中执行
+    void SetParallelUpdateEnabled(bool enabled);
+
+    /// \~chinese
+    /// @brief 设置更新时读写的数据
+    /// @details 数据由用户自定义的位掩码表示，一个组件写入的数据与另一个组件读取或写入的数据有交集时，两个组件不会并行更新
+    /// @param reads 读取的数据
+    /// @param writes 写入的数据
+    void SetUpdateAccess(uint32_t reads, uint32_t writes);
+
+    /// \~chinese
+    /// @brief 添加更新依赖
+    /// @details 依赖的组件更新完成后才会更新该组件，与注册的先后顺序无关。会形成循环依赖的组件将被拒绝
+    /// @param component 依赖的组件
+    void AddUpdateDependency(UpdateComponent* component);
+
+    /// \~chinese
+    /// @brief 获取上一帧 OnUpdate 的开始时间（微秒）
+    /// @see Time::NowMicroseconds
+    int64_t GetUpdateStartTime() const;
+
+    /// \~chinese
+    /// @brief 获取上一帧 OnUpdate 的耗时（微秒）
+    int64_t GetUpdateCost() const;
+
+    /// \~chinese
+    /// @brief 判断两个组件能否并行更新
+    bool CanUpdateWith(UpdateComponent* other) const;
+
 public:
     static const int flag;
 
     UpdateComponent();
+
+private:
+    bool DependsOn(UpdateComponent* component) const;
+
+private:
+    bool                     parallel_;
+    uint32_t                 reads_;
+    uint32_t                 writes_;
+    int64_t                  update_start_;
+    int64_t                  update_cost_;
+    Vector<UpdateComponent*> dependencies_;
 };
 
 /**
@@ -120,4 +171,30 @@ public:
 
     EventComponent();
 };
+
+inline bool UpdateComponent::IsParallelUpdateEnabled() const
+{
+    return parallel_;
+}
+
+inline void UpdateComponent::SetParallelUpdateEnabled(bool enabled)
+{
+    parallel_ = enabled;
+}
+
+inline void UpdateComponent::SetUpdateAccess(uint32_t reads, uint32_t writes)
+{
+    reads_  = reads;
+    writes_ = writes;
+}
+
+inline int64_t UpdateComponent::GetUpdateStartTime() const
+{
+    return update_start_;
+}
+
+inline int64_t UpdateComponent::GetUpdateCost() const
+{
+    return update_cost_;
+}
 }  // namespace kiwano
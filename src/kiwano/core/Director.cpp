@@ -22,13 +22,18 @@
 #include <kiwano/2d/DebugActor.h>
 #include <kiwano/2d/Stage.h>
 #include <kiwano/2d/Transition.h>
+#include <kiwano/2d/action/TweenSystem.h>
 #include <kiwano/core/Director.h>
+#include <kiwano/core/Profiler.h>
 #include <kiwano/render/RenderContext.h>
 
 namespace kiwano
 {
 Director::Director()
     : render_border_enabled_(false)
+    , animating_(false)
+    , push_loaded_stage_(false)
+    , last_ticked_count_(0)
 {
 }
 
@@ -42,6 +47,7 @@ void Director::EnterStage(StagePtr stage, TransitionPtr transition)
         return;
 
     next_stage_ = stage;
+    next_stage_->WakeUp();
 
     if (transition && next_stage_)
     {
@@ -72,6 +78,9 @@ void Director::PopStage(TransitionPtr transition)
     {
         next_stage_ = stages_.top();
         stages_.pop();
+
+        // Restore the stage before a transition starts rendering it
+        next_stage_->WakeUp();
     }
 
     if (transition && next_stage_)
@@ -85,6 +94,25 @@ void Director::PopStage(TransitionPtr transition)
     }
 }
 
+void Director::EnterStageAsync(StageLoaderPtr loader, TransitionPtr transition)
+{
+    KGE_ASSERT(loader && loader->GetStage() && "Director::EnterStageAsync failed, NULL pointer exception");
+
+    // The replaced loader may still have jobs queued in the application
+    if (loader_ && loader_ != loader)
+        loader_->Cancel();
+
+    loader_            = loader;
+    loader_transition_ = transition;
+    push_loaded_stage_ = false;
+}
+
+void Director::PushStageAsync(StageLoaderPtr loader, TransitionPtr transition)
+{
+    EnterStageAsync(loader, transition);
+    push_loaded_stage_ = true;
+}
+
 StagePtr Director::GetCurrentStage()
 {
     return current_stage_;
@@ -116,11 +144,33 @@ void Director::ClearStages()
     current_stage_.reset();
     next_stage_.reset();
     transition_.reset();
+    if (loader_)
+        loader_->Cancel();
+    loader_.reset();
+    loader_transition_.reset();
     debug_actor_.reset();
 }
 
 void Director::OnUpdate(Duration dt)
 {
+    Profiler& profiler = Profiler::Instance();
+    if (profiler.IsEnabled())
+        profiler.BeginFrame();
+
+    if (loader_ && loader_->Update())
+    {
+        StagePtr      stage      = loader_->GetStage();
+        TransitionPtr transition = loader_transition_;
+
+        loader_            = nullptr;
+        loader_transition_ = nullptr;
+
+        if (push_loaded_stage_)
+            PushStage(stage, transition);
+        else
+            EnterStage(stage, transition);
+    }
+
     if (transition_)
     {
         transition_->Update(dt);
@@ -134,6 +184,12 @@ void Director::OnUpdate(Duration dt)
         if (current_stage_)
         {
             current_stage_->OnExit();
+
+            // A stage pushed below the top is no longer displayed
+            if (!stages_.empty() && stages_.top() == current_stage_)
+            {
+                current_stage_->Hibernate();
+            }
         }
 
         next_stage_->OnEnter();
@@ -142,14 +198,29 @@ void Director::OnUpdate(Duration dt)
         next_stage_    = nullptr;
     }
 
+    bool animating = transition_;
+
     if (current_stage_)
+    {
+        TweenSystem::Instance().Update(dt, current_stage_.get());
         current_stage_->Update(dt);
+    }
 
     if (next_stage_)
+    {
+        TweenSystem::Instance().Update(dt, next_stage_.get());
         next_stage_->Update(dt);
+    }
 
     if (debug_actor_)
         debug_actor_->Update(dt);
+
+    // Paused tweens and tweens on stages that are not updated do not tick
+    const uint64_t ticked_count =
+        ActionManager::GetTotalTickedCount() + TweenSystem::Instance().GetTotalTickedCount();
+
+    animating_         = animating || ticked_count != last_ticked_count_;
+    last_ticked_count_ = ticked_count;
 }
 
 void Director::OnRender(RenderContext& ctx)
@@ -21,6 +21,7 @@
 #pragma once
 #include <kiwano/2d/Actor.h>
 #include <kiwano/2d/Stage.h>
+#include <kiwano/2d/StageLoader.h>
 #include <kiwano/2d/Transition.h>
 #include <kiwano/core/Component.h>
 
@@ -52,6 +53,8 @@ public:
     /**
      * \~chinese
      * @brief 切换舞台，并将当前舞台储存到栈中
+     * @details 启用了休眠的舞台会在切换完成后进入休眠
+     * @see Stage::SetHibernationMode
      * @param[in] stage 舞台
      * @param[in] transition 过渡动画
      */
@@ -64,6 +67,31 @@ public:
      */
     void PopStage(TransitionPtr transition = nullptr);
 
+    /**
+     * \~chinese
+     * @brief 异步加载舞台，加载完成后切换舞台
+     * @details 加载期间当前舞台继续更新和渲染，加载完成后过渡动画才开始播放。
+     *          再次调用时，未完成的加载将被取消
+     * @param[in] loader 舞台加载器
+     * @param[in] transition 过渡动画
+     */
+    void EnterStageAsync(StageLoaderPtr loader, TransitionPtr transition = nullptr);
+
+    /**
+     * \~chinese
+     * @brief 异步加载舞台，加载完成后切换舞台，并将当前舞台储存到栈中
+     * @param[in] loader 舞台加载器
+     * @param[in] transition 过渡动画
+     */
+    void PushStageAsync(StageLoaderPtr loader, TransitionPtr transition = nullptr);
+
+    /**
+     * \~chinese
+     * @brief 获取正在加载的舞台加载器
+     * @return 没有正在加载的舞台时返回空
+     */
+    StageLoaderPtr GetStageLoader() const;
+
     /**
      * \~chinese
      * @brief 获取当前舞台
@@ -91,6 +119,12 @@ public:
      */
     void ClearStages();
 
+    /**
+     * \~chinese
+     * @brief 上一次更新时是否有动画或过渡动画正在播放
+     */
+    bool IsAnimating() const;
+
 public:
     void SetupComponent() override {}
 
@@ -114,5 +148,20 @@ private:
     StagePtr        next_stage_;
     ActorPtr        debug_actor_;
     TransitionPtr   transition_;
+    bool            animating_;
+    bool            push_loaded_stage_;
+    uint64_t        last_ticked_count_;
+    StageLoaderPtr  loader_;
+    TransitionPtr   loader_transition_;
 };
+
+inline StageLoaderPtr Director::GetStageLoader() const
+{
+    return loader_;
+}
+
+inline bool Director::IsAnimating() const
+{
+    return animating_;
+}
 }  // namespace kiwano
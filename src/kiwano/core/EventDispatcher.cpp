@@ -20,29 +20,125 @@
 
 #include <kiwano/core/EventDispatcher.h>
 #include <kiwano/core/Logger.h>
+#include <kiwano/core/Profiler.h>
 
 namespace kiwano
 {
+EventDispatcher::EventDispatcher()
+    : dirty_(false)
+    , dispatching_(0)
+    , next_order_(0)
+    , swallow_order_(UINT32_MAX)
+{
+}
+
+EventDispatcher::~EventDispatcher()
+{
+    for (auto& listener : listeners_)
+    {
+        listener.dispatcher_ = nullptr;
+    }
+}
+
 bool EventDispatcher::DispatchEvent(Event* evt)
 {
     if (listeners_.empty())
         return true;
 
+    if (dirty_ && dispatching_ == 0)
+        RebuildBuckets();
+
+    uint32_t invoked = 0;
+
+    int index = FindBucket(evt->GetType());
+    if (index >= 0)
+    {
+        ++dispatching_;
+
+        // Listeners added by callbacks will not receive this event
+        const size_t count = buckets_[index].listeners.size();
+        for (size_t i = 0; i < count; ++i)
+        {
+            EventListener* listener = buckets_[index].listeners[i];
+
+            // Listeners after a swallowing listener never receive events
+            if (listener->order_ > swallow_order_)
+                break;
+
+            // Removed listeners receive no more events, even if they are removed during this dispatch
+            if (listener->IsRunning() && !listener->IsRemoveable())
+            {
+                listener->Receive(evt);
+                ++invoked;
+            }
+        }
+
+        --dispatching_;
+    }
+
+    // Any swallowing listener stops the event, whatever type it listens to
+    const bool swallowed = (swallow_order_ != UINT32_MAX);
+
+    if (dirty_ && dispatching_ == 0)
+        RebuildBuckets();
+
+    Profiler& profiler = Profiler::Instance();
+    if (profiler.IsEnabled())
+        profiler.IncreaseListenersInvoked(invoked);
+    return !swallowed;
+}
+
+int EventDispatcher::FindBucket(EventType const& type) const
+{
+    for (size_t i = 0; i < buckets_.size(); ++i)
+    {
+        if (buckets_[i].type == type)
+            return int(i);
+    }
+    return -1;
+}
+
+void EventDispatcher::IndexListener(EventListener* listener)
+{
+    int index = FindBucket(listener->GetEventType());
+    if (index < 0)
+    {
+        ListenerBucket bucket;
+        bucket.type = listener->GetEventType();
+        buckets_.push_back(bucket);
+        index = int(buckets_.size() - 1);
+    }
+    buckets_[index].listeners.push_back(listener);
+
+    if (listener->IsSwallowEnabled() && listener->order_ < swallow_order_)
+        swallow_order_ = listener->order_;
+}
+
+void EventDispatcher::RebuildBuckets()
+{
+    dirty_         = false;
+    swallow_order_ = UINT32_MAX;
+
+    for (auto& bucket : buckets_)
+    {
+        bucket.listeners.clear();
+    }
+
     EventListenerPtr next;
     for (auto listener = listeners_.first_item(); listener; listener = next)
     {
         next = listener->next_item();
 
-        if (listener->IsRunning())
-            listener->Receive(evt);
-
         if (listener->IsRemoveable())
+        {
+            listener->dispatcher_ = nullptr;
             listeners_.remove(listener);
-
-        if (listener->IsSwallowEnabled())
-            return false;
+        }
+        else
+        {
+            IndexListener(listener.get());
+        }
     }
-    return true;
 }
 
 EventListener* EventDispatcher::AddListener(EventListenerPtr listener)
@@ -56,7 +152,13 @@ EventListener* EventDispatcher::AddListener(EventListener* listener)
 
     if (listener)
     {
+        listener->dispatcher_ = this;
+        listener->order_      = next_order_++;
         listeners_.push_back(listener);
+
+        // Buckets will be rebuilt before the next dispatch if they are dirty
+        if (!dirty_)
+            IndexListener(listener);
     }
     return listener;
 }
@@ -108,34 +210,46 @@ void EventDispatcher::RemoveListeners(String const& listener_name)
 
 void EventDispatcher::StartListeners(const EventType& type)
 {
-    for (auto& listener : listeners_)
+    if (dirty_ && dispatching_ == 0)
+        RebuildBuckets();
+
+    int index = FindBucket(type);
+    if (index < 0)
+        return;
+
+    for (auto listener : buckets_[index].listeners)
     {
-        if (listener.GetEventType() == type)
-        {
-            listener.Start();
-        }
+        listener->Start();
     }
 }
 
 void EventDispatcher::StopListeners(const EventType& type)
 {
-    for (auto& listener : listeners_)
+    if (dirty_ && dispatching_ == 0)
+        RebuildBuckets();
+
+    int index = FindBucket(type);
+    if (index < 0)
+        return;
+
+    for (auto listener : buckets_[index].listeners)
     {
-        if (listener.GetEventType() == type)
-        {
-            listener.Stop();
-        }
+        listener->Stop();
     }
 }
 
 void EventDispatcher::RemoveListeners(const EventType& type)
 {
-    for (auto& listener : listeners_)
+    if (dirty_ && dispatching_ == 0)
+        RebuildBuckets();
+
+    int index = FindBucket(type);
+    if (index < 0)
+        return;
+
+    for (auto listener : buckets_[index].listeners)
     {
-        if (listener.GetEventType() == type)
-        {
-            listener.Remove();
-        }
+        listener->Remove();
     }
 }
 
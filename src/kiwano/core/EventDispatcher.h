@@ -26,14 +26,22 @@ namespace kiwano
 /**
  * \~chinese
  * @brief 事件分发系统
+ * @details 监听器按事件类型分组索引，分发事件时只访问监听该类型事件的监听器
+ * @note 监听器被移除后立即停止接收事件，包括在分发过程中被移除的监听器
  */
 class KGE_API EventDispatcher
 {
+    friend class EventListener;
+
 public:
     /// \~chinese
     /// @brief 监听器列表
     using Listeners = IntrusiveList<EventListenerPtr>;
 
+    EventDispatcher();
+
+    ~EventDispatcher();
+
     /// \~chinese
     /// @brief 添加监听器
     EventListener* AddListener(EventListenerPtr listener);
@@ -129,6 +137,33 @@ public:
     bool DispatchEvent(Event* evt);
 
 private:
-    Listeners listeners_;
+    /// \~chinese
+    /// @brief 同一事件类型的监听器，按添加顺序排列
+    struct ListenerBucket
+    {
+        EventType              type;
+        Vector<EventListener*> listeners;
+    };
+
+    /// \~chinese
+    /// @brief 查找事件类型对应的分组
+    /// @return 分组下标，不存在时返回 -1
+    int FindBucket(EventType const& type) const;
+
+    /// \~chinese
+    /// @brief 将监听器加入分组
+    void IndexListener(EventListener* listener);
+
+    /// \~chinese
+    /// @brief 删除已移除的监听器，并重建分组
+    void RebuildBuckets();
+
+private:
+    bool                   dirty_;
+    int                    dispatching_;
+    uint32_t               next_order_;
+    uint32_t               swallow_order_;
+    Listeners              listeners_;
+    Vector<ListenerBucket> buckets_;
 };
 }  // namespace kiwano
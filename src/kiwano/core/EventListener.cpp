@@ -19,6 +19,7 @@
 // THE SOFTWARE.
 
 #pragma once
+#include <kiwano/core/EventDispatcher.h>
 #include <kiwano/core/EventListener.h>
 
 namespace kiwano
@@ -53,9 +54,35 @@ EventListener::EventListener()
     , running_(true)
     , removeable_(false)
     , swallow_(false)
+    , order_(0)
+    , dispatcher_(nullptr)
 {
 }
 
 EventListener::~EventListener() {}
 
+void EventListener::Remove()
+{
+    removeable_ = true;
+
+    if (dispatcher_)
+        dispatcher_->dirty_ = true;
+}
+
+void EventListener::SetSwallowEnabled(bool enabled)
+{
+    swallow_ = enabled;
+
+    if (dispatcher_)
+        dispatcher_->dirty_ = true;
+}
+
+void EventListener::SetEventType(EventType const& type)
+{
+    type_ = type;
+
+    if (dispatcher_)
+        dispatcher_->dirty_ = true;
+}
+
 }  // namespace kiwano
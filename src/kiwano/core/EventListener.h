@@ -97,6 +97,7 @@ public:
 
     /// \~chinese
     /// @brief 移除监听器
+    /// @details 移除后不再接收任何事件，即使正在分发的事件还未传递给该监听器
     void Remove();
 
     /// \~chinese
@@ -146,11 +147,13 @@ public:
     void Receive(Event* evt);
 
 private:
-    bool      running_;
-    bool      removeable_;
-    bool      swallow_;
-    EventType type_;
-    Callback  callback_;
+    bool             running_;
+    bool             removeable_;
+    bool             swallow_;
+    uint32_t         order_;
+    EventType        type_;
+    Callback         callback_;
+    EventDispatcher* dispatcher_;
 };
 
 inline void EventListener::Start()
@@ -163,11 +166,6 @@ inline void EventListener::Stop()
     running_ = false;
 }
 
-inline void EventListener::Remove()
-{
-    removeable_ = true;
-}
-
 inline bool EventListener::IsRunning() const
 {
     return running_;
@@ -183,11 +181,6 @@ inline bool EventListener::IsSwallowEnabled() const
     return swallow_;
 }
 
-inline void EventListener::SetSwallowEnabled(bool enabled)
-{
-    swallow_ = enabled;
-}
-
 inline const EventListener::Callback& EventListener::GetCallback() const
 {
     return callback_;
@@ -203,11 +196,6 @@ inline EventType EventListener::GetEventType() const
     return type_;
 }
 
-inline void EventListener::SetEventType(EventType const& type)
-{
-    type_ = type;
-}
-
 inline void EventListener::Receive(Event* evt)
 {
     KGE_ASSERT(evt != nullptr);
@@ -0,0 +1,172 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <kiwano/core/ObjectPool.h>
+#include <atomic>
+
+namespace kiwano
+{
+namespace
+{
+
+// All state is trivially destructible, so objects released during
+// static destruction can still return their memory safely.
+
+const size_t block_granularity = 16;
+const size_t bucket_count      = 64;  // blocks up to 1024 bytes are cached
+
+struct FreeBlock
+{
+    FreeBlock* next;
+};
+
+struct Bucket
+{
+    FreeBlock* head;
+    size_t     count;
+};
+
+Bucket           buckets[bucket_count] = {};
+size_t           max_cached_count      = 1024;
+size_t           allocated_count       = 0;
+size_t           reused_count          = 0;
+std::atomic_flag pool_lock             = ATOMIC_FLAG_INIT;
+
+class PoolLock
+{
+public:
+    PoolLock()
+    {
+        while (pool_lock.test_and_set(std::memory_order_acquire))
+            ;
+    }
+
+    ~PoolLock()
+    {
+        pool_lock.clear(std::memory_order_release);
+    }
+};
+
+inline size_t GetBucketIndex(size_t size)
+{
+    return (size + block_granularity - 1) / block_granularity - 1;
+}
+
+inline size_t GetBlockSize(size_t size)
+{
+    return (size + block_granularity - 1) / block_granularity * block_granularity;
+}
+
+}  // namespace
+
+void* ObjectPool::Allocate(size_t size) noexcept
+{
+    size_t index = GetBucketIndex(size);
+    if (index < bucket_count)
+    {
+        PoolLock lock;
+
+        Bucket& bucket = buckets[index];
+        if (bucket.head)
+        {
+            FreeBlock* block = bucket.head;
+            bucket.head      = block->next;
+            --bucket.count;
+            ++reused_count;
+            return block;
+        }
+        ++allocated_count;
+    }
+    else
+    {
+        PoolLock lock;
+        ++allocated_count;
+    }
+    return ::operator new(GetBlockSize(size), std::nothrow);
+}
+
+void ObjectPool::Free(void* ptr, size_t size) noexcept
+{
+    if (!ptr)
+        return;
+
+    size_t index = GetBucketIndex(size);
+    if (index < bucket_count)
+    {
+        PoolLock lock;
+
+        Bucket& bucket = buckets[index];
+        if (bucket.count < max_cached_count)
+        {
+            FreeBlock* block = static_cast<FreeBlock*>(ptr);
+            block->next      = bucket.head;
+            bucket.head      = block;
+            ++bucket.count;
+            return;
+        }
+    }
+    ::operator delete(ptr);
+}
+
+void ObjectPool::SetMaxCachedCount(size_t count)
+{
+    PoolLock lock;
+    max_cached_count = count;
+}
+
+size_t ObjectPool::GetMaxCachedCount()
+{
+    return max_cached_count;
+}
+
+void ObjectPool::Clear()
+{
+    PoolLock lock;
+    for (auto& bucket : buckets)
+    {
+        while (bucket.head)
+        {
+            FreeBlock* block = bucket.head;
+            bucket.head      = block->next;
+            ::operator delete(block);
+        }
+        bucket.count = 0;
+    }
+}
+
+size_t ObjectPool::GetAllocatedCount()
+{
+    return allocated_count;
+}
+
+size_t ObjectPool::GetReusedCount()
+{
+    return reused_count;
+}
+
+void ObjectPool::ResetCounters()
+{
+    PoolLock lock;
+    allocated_count = 0;
+    reused_count    = 0;
+}
+
+}  // namespace kiwano
@@ -0,0 +1,72 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+#include <kiwano/core/Common.h>
+
+namespace kiwano
+{
+
+/// \~chinese
+/// @brief 对象内存池
+/// @details 小对象的内存按大小分类缓存在空闲链表中，销毁的对象所占用的内存会被之后创建的同样大小的对象复用，
+/// 避免频繁创建动画、事件等短生命周期对象时反复向系统申请内存
+class KGE_API ObjectPool
+{
+public:
+    /// \~chinese
+    /// @brief 申请内存
+    /// @param size 内存大小
+    /// @return 申请失败时返回空
+    static void* Allocate(size_t size) noexcept;
+
+    /// \~chinese
+    /// @brief 释放内存
+    /// @param ptr 内存地址
+    /// @param size 内存大小，必须与申请时一致
+    static void Free(void* ptr, size_t size) noexcept;
+
+    /// \~chinese
+    /// @brief 设置每类大小最多缓存的内存块数量
+    static void SetMaxCachedCount(size_t count);
+
+    /// \~chinese
+    /// @brief 获取每类大小最多缓存的内存块数量
+    static size_t GetMaxCachedCount();
+
+    /// \~chinese
+    /// @brief 释放所有缓存的内存块
+    static void Clear();
+
+    /// \~chinese
+    /// @brief 获取向系统申请内存的次数
+    static size_t GetAllocatedCount();
+
+    /// \~chinese
+    /// @brief 获取复用缓存内存块的次数
+    static size_t GetReusedCount();
+
+    /// \~chinese
+    /// @brief 重置计数
+    static void ResetCounters();
+};
+
+}  // namespace kiwano
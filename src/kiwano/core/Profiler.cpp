@@ -0,0 +1,174 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <kiwano/core/Profiler.h>
+
+namespace kiwano
+{
+
+void SceneStatistics::Reset()
+{
+    actors            = 0;
+    max_depth         = 0;
+    actions_ticked    = 0;
+    timers_ticked     = 0;
+    listeners_invoked = 0;
+    culled_actors     = 0;
+    update_time       = 0.f;
+    render_time       = 0.f;
+}
+
+Profiler::Profiler()
+    : enabled_(false)
+    , depth_(0)
+    , ms_per_tick_(0)
+{
+    LARGE_INTEGER freq;
+    ::QueryPerformanceFrequency(&freq);
+    ms_per_tick_ = 1000.0 / double(freq.QuadPart);
+}
+
+Profiler::~Profiler() {}
+
+void Profiler::SetEnabled(bool enabled)
+{
+    enabled_ = enabled;
+    depth_   = 0;
+    scopes_.clear();
+}
+
+void Profiler::Track(String const& name)
+{
+    size_t hash = std::hash<String>{}(name);
+    if (tracked_.find(hash) == tracked_.end())
+    {
+        tracked_[hash].name = name;
+    }
+}
+
+void Profiler::Untrack(String const& name)
+{
+    tracked_.erase(std::hash<String>{}(name));
+}
+
+SceneStatistics Profiler::GetStatistics(String const& name) const
+{
+    auto iter = tracked_.find(std::hash<String>{}(name));
+    if (iter != tracked_.end())
+    {
+        return iter->second.last;
+    }
+    return SceneStatistics();
+}
+
+void Profiler::BeginFrame()
+{
+    for (auto& pair : tracked_)
+    {
+        pair.second.last = pair.second.current;
+        pair.second.current.Reset();
+    }
+}
+
+SceneStatistics* Profiler::FindTracked(size_t name_hash)
+{
+    if (tracked_.empty())
+        return nullptr;
+
+    auto iter = tracked_.find(name_hash);
+    if (iter != tracked_.end())
+    {
+        return &iter->second.current;
+    }
+    return nullptr;
+}
+
+void Profiler::BeginNode(SceneStatistics* scope, Phase phase)
+{
+    ++depth_;
+
+    if (scope)
+    {
+        scopes_.push_back(Scope{ scope, depth_, (phase == Phase::Event) ? 0 : GetTicks() });
+    }
+
+    if (phase == Phase::Update)
+    {
+        for (auto& s : scopes_)
+        {
+            ++s.stats->actors;
+            s.stats->max_depth = std::max(s.stats->max_depth, depth_ - s.base_depth + 1);
+        }
+    }
+}
+
+void Profiler::EndNode(SceneStatistics* scope, Phase phase)
+{
+    if (scope && !scopes_.empty())
+    {
+        const Scope& s = scopes_.back();
+        if (phase != Phase::Event)
+        {
+            float elapsed = float((GetTicks() - s.start) * ms_per_tick_);
+            if (phase == Phase::Update)
+                s.stats->update_time += elapsed;
+            else
+                s.stats->render_time += elapsed;
+        }
+        scopes_.pop_back();
+    }
+
+    if (depth_ > 0)
+        --depth_;
+}
+
+void Profiler::IncreaseActionsTicked(uint32_t count)
+{
+    for (auto& s : scopes_)
+        s.stats->actions_ticked += count;
+}
+
+void Profiler::IncreaseTimersTicked(uint32_t count)
+{
+    for (auto& s : scopes_)
+        s.stats->timers_ticked += count;
+}
+
+void Profiler::IncreaseListenersInvoked(uint32_t count)
+{
+    for (auto& s : scopes_)
+        s.stats->listeners_invoked += count;
+}
+
+void Profiler::IncreaseCulledActors(uint32_t count)
+{
+    for (auto& s : scopes_)
+        s.stats->culled_actors += count;
+}
+
+int64_t Profiler::GetTicks() const
+{
+    LARGE_INTEGER count;
+    ::QueryPerformanceCounter(&count);
+    return count.QuadPart;
+}
+
+}  // namespace kiwano
@@ -0,0 +1,163 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+#include <kiwano/core/Common.h>
+
+namespace kiwano
+{
+
+/**
+ * \~chinese
+ * @brief 场景统计信息
+ * @details 统计一帧内（从更新开始，到下一帧更新开始前）场景或子树的开销
+ */
+struct KGE_API SceneStatistics
+{
+    uint32_t actors;             ///< 角色数量
+    uint32_t max_depth;          ///< 最大深度
+    uint32_t actions_ticked;     ///< 更新的动画数量
+    uint32_t timers_ticked;      ///< 更新的定时器数量
+    uint32_t listeners_invoked;  ///< 调用的监听器数量
+    uint32_t culled_actors;      ///< 被遮挡剔除的角色数量
+    float    update_time;        ///< 更新耗时（毫秒）
+    float    render_time;        ///< 渲染耗时（毫秒）
+
+    SceneStatistics();
+
+    /// \~chinese
+    /// @brief 重置所有统计数据
+    void Reset();
+};
+
+/**
+ * \~chinese
+ * @brief 性能分析器
+ * @details 启用后每帧统计舞台和被跟踪的子树的开销，禁用时几乎没有额外开销
+ */
+class KGE_API Profiler : public Singleton<Profiler>
+{
+    friend Singleton<Profiler>;
+
+public:
+    /// \~chinese
+    /// @brief 统计阶段
+    enum class Phase
+    {
+        Event,   ///< 事件分发
+        Update,  ///< 更新
+        Render,  ///< 渲染
+    };
+
+    /// \~chinese
+    /// @brief 是否启用
+    bool IsEnabled() const;
+
+    /// \~chinese
+    /// @brief 启用或禁用性能分析，默认禁用
+    void SetEnabled(bool enabled);
+
+    /// \~chinese
+    /// @brief 跟踪指定名称的子树
+    /// @details 名称相同的多个子树的统计数据将被累加
+    void Track(String const& name);
+
+    /// \~chinese
+    /// @brief 停止跟踪指定名称的子树
+    void Untrack(String const& name);
+
+    /// \~chinese
+    /// @brief 获取被跟踪的子树上一帧的统计信息
+    SceneStatistics GetStatistics(String const& name) const;
+
+    /// \~chinese
+    /// @brief 开始新的一帧，保存被跟踪子树上一帧的统计数据
+    void BeginFrame();
+
+    /// \~chinese
+    /// @brief 查找正在被跟踪的子树的统计数据
+    /// @param name_hash 名称的哈希值
+    SceneStatistics* FindTracked(size_t name_hash);
+
+    /// \~chinese
+    /// @brief 进入一个节点
+    /// @param scope 以该节点为根的统计数据，不是统计根节点时为空
+    void BeginNode(SceneStatistics* scope, Phase phase);
+
+    /// \~chinese
+    /// @brief 离开一个节点
+    void EndNode(SceneStatistics* scope, Phase phase);
+
+    /// \~chinese
+    /// @brief 增加更新的动画数量
+    void IncreaseActionsTicked(uint32_t count);
+
+    /// \~chinese
+    /// @brief 增加更新的定时器数量
+    void IncreaseTimersTicked(uint32_t count);
+
+    /// \~chinese
+    /// @brief 增加调用的监听器数量
+    void IncreaseListenersInvoked(uint32_t count);
+
+    /// \~chinese
+    /// @brief 增加被遮挡剔除的角色数量
+    void IncreaseCulledActors(uint32_t count);
+
+private:
+    Profiler();
+
+    ~Profiler();
+
+    int64_t GetTicks() const;
+
+private:
+    struct TrackedSubtree
+    {
+        String          name;
+        SceneStatistics current;
+        SceneStatistics last;
+    };
+
+    struct Scope
+    {
+        SceneStatistics* stats;
+        uint32_t         base_depth;
+        int64_t          start;
+    };
+
+    bool                                 enabled_;
+    uint32_t                             depth_;
+    double                               ms_per_tick_;
+    Vector<Scope>                        scopes_;
+    UnorderedMap<size_t, TrackedSubtree> tracked_;
+};
+
+inline SceneStatistics::SceneStatistics()
+{
+    Reset();
+}
+
+inline bool Profiler::IsEnabled() const
+{
+    return enabled_;
+}
+}  // namespace kiwano
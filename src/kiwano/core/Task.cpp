@@ -0,0 +1,164 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <kiwano/2d/Actor.h>
+#include <kiwano/core/ObjectPool.h>
+#include <kiwano/core/Logger.h>
+#include <kiwano/core/Task.h>
+
+#ifdef KGE_HAS_COROUTINE
+
+namespace kiwano
+{
+void Task::promise_type::unhandled_exception()
+{
+    try
+    {
+        throw;
+    }
+    catch (std::exception& e)
+    {
+        KGE_ERROR(L"Unhandled exception in task: %s", oc::string_to_wide(e.what()).c_str());
+    }
+    catch (...)
+    {
+        KGE_ERROR(L"Unhandled exception in task");
+    }
+}
+
+void* Task::promise_type::operator new(size_t size)
+{
+    void* ptr = ObjectPool::Allocate(size);
+    if (!ptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void Task::promise_type::operator delete(void* ptr, size_t size) noexcept
+{
+    ObjectPool::Free(ptr, size);
+}
+
+void Task::Awaiter::await_suspend(Handle handle)
+{
+    promise_type& promise = handle.promise();
+
+    promise.wait = wait;
+
+    Actor* target = promise.target;
+    if (!target)
+        return;
+
+    switch (promise.wait.kind)
+    {
+    case TaskWait::Kind::Action:
+        if (promise.wait.action)
+            target->AddAction(promise.wait.action);
+        break;
+    case TaskWait::Kind::Event:
+    {
+        bool* triggered       = &promise.wait.triggered;
+        promise.wait.listener = target->AddListener(promise.wait.event_type, [=](Event*) { *triggered = true; });
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+Task::Awaiter Task::NextFrame()
+{
+    Awaiter awaiter;
+    awaiter.wait.kind = TaskWait::Kind::Frame;
+    return awaiter;
+}
+
+Task::Awaiter Task::Delay(Duration duration)
+{
+    Awaiter awaiter;
+    awaiter.wait.kind      = TaskWait::Kind::Delay;
+    awaiter.wait.remaining = duration;
+    return awaiter;
+}
+
+Task::Awaiter Task::Play(ActionPtr action)
+{
+    Awaiter awaiter;
+    awaiter.wait.kind   = TaskWait::Kind::Action;
+    awaiter.wait.action = action;
+    return awaiter;
+}
+
+Task::Awaiter Task::WaitEvent(EventType type)
+{
+    Awaiter awaiter;
+    awaiter.wait.kind       = TaskWait::Kind::Event;
+    awaiter.wait.event_type = type;
+    return awaiter;
+}
+
+Task::Task()
+    : handle_(nullptr)
+{
+}
+
+Task::Task(Handle handle)
+    : handle_(handle)
+{
+}
+
+Task::Task(Task&& other) noexcept
+    : handle_(other.Release())
+{
+}
+
+Task& Task::operator=(Task&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (handle_)
+            handle_.destroy();
+        handle_ = other.Release();
+    }
+    return *this;
+}
+
+Task::~Task()
+{
+    if (handle_)
+        handle_.destroy();
+}
+
+bool Task::IsDone() const
+{
+    return !handle_ || handle_.done();
+}
+
+Task::Handle Task::Release()
+{
+    Handle handle = handle_;
+    handle_       = nullptr;
+    return handle;
+}
+
+}  // namespace kiwano
+
+#endif
@@ -0,0 +1,184 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+#include <kiwano/2d/action/Action.h>
+#include <kiwano/core/EventListener.h>
+#include <kiwano/core/Time.h>
+
+#ifdef KGE_HAS_COROUTINE
+#include <coroutine>
+
+namespace kiwano
+{
+class Actor;
+class TaskManager;
+
+/// \~chinese
+/// @brief 协程任务的等待条件
+struct TaskWait
+{
+    /// \~chinese
+    /// @brief 等待类型
+    enum class Kind
+    {
+        None,    ///< 不等待
+        Frame,   ///< 等待下一帧
+        Delay,   ///< 等待一段时间
+        Action,  ///< 等待动画结束
+        Event,   ///< 等待事件
+    };
+
+    Kind             kind      = Kind::None;
+    bool             triggered = false;
+    Duration         remaining;
+    ActionPtr        action;
+    EventType        event_type = KGE_EVENT(Event);
+    EventListenerPtr listener;
+};
+
+/**
+ * \~chinese
+ * @brief 协程任务
+ * @details 在角色上启动的协程，由角色的更新驱动恢复执行，可以等待下一帧、一段时间、动画结束或事件。
+ * 协程帧的内存来自 ObjectPool
+ * @code
+ *   Task Patrol()
+ *   {
+ *       for (;;)
+ *       {
+ *           co_await Task::Play(new ActionMoveBy(1_sec, Vec2(100, 0)));
+ *           co_await Task::Delay(500_msec);
+ *           Fire();
+ *       }
+ *   }
+ *
+ *   actor->StartTask(Patrol());
+ * @endcode
+ */
+class KGE_API Task
+{
+    friend class TaskManager;
+
+public:
+    struct promise_type
+    {
+        Actor*   target  = nullptr;
+        bool     stopped = false;
+        TaskWait wait;
+
+        Task get_return_object()
+        {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void() {}
+
+        void unhandled_exception();
+
+        static void* operator new(size_t size);
+
+        static void operator delete(void* ptr, size_t size) noexcept;
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    /// \~chinese
+    /// @brief 等待对象
+    struct Awaiter
+    {
+        TaskWait wait;
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(Handle handle);
+
+        void await_resume() const noexcept {}
+    };
+
+    /// \~chinese
+    /// @brief 等待下一帧
+    static Awaiter NextFrame();
+
+    /// \~chinese
+    /// @brief 等待一段时间
+    /// @param duration 时长
+    static Awaiter Delay(Duration duration);
+
+    /// \~chinese
+    /// @brief 在角色上执行动画并等待其结束
+    /// @param action 动画
+    static Awaiter Play(ActionPtr action);
+
+    /// \~chinese
+    /// @brief 等待角色接收到指定类型的事件
+    /// @param type 事件类型
+    static Awaiter WaitEvent(EventType type);
+
+    /// \~chinese
+    /// @brief 等待角色接收到指定类型的事件
+    template <typename _EventTy>
+    static Awaiter WaitEvent()
+    {
+        return WaitEvent(KGE_EVENT(_EventTy));
+    }
+
+    Task();
+
+    Task(Task&& other) noexcept;
+
+    Task& operator=(Task&& other) noexcept;
+
+    Task(Task const&) = delete;
+
+    Task& operator=(Task const&) = delete;
+
+    ~Task();
+
+    /// \~chinese
+    /// @brief 任务是否已结束
+    bool IsDone() const;
+
+private:
+    explicit Task(Handle handle);
+
+    Handle Release();
+
+private:
+    Handle handle_;
+};
+
+}  // namespace kiwano
+
+#endif
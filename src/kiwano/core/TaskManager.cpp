@@ -0,0 +1,146 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <kiwano/core/TaskManager.h>
+
+namespace kiwano
+{
+#ifdef KGE_HAS_COROUTINE
+namespace
+{
+
+bool IsTaskReady(TaskWait& wait, Duration dt)
+{
+    switch (wait.kind)
+    {
+    case TaskWait::Kind::Delay:
+        wait.remaining -= dt;
+        return wait.remaining <= 0;
+    case TaskWait::Kind::Action:
+        return !wait.action || wait.action->IsDone();
+    case TaskWait::Kind::Event:
+        return wait.triggered;
+    default:
+        return true;
+    }
+}
+
+void ClearTaskWait(TaskWait& wait)
+{
+    if (wait.listener)
+    {
+        // Stopped listeners are not invoked before they are removed
+        wait.listener->Stop();
+        wait.listener->Remove();
+    }
+
+    wait = TaskWait();
+}
+
+}  // namespace
+
+TaskManager::TaskManager()
+    : updating_(false)
+{
+}
+
+TaskManager::~TaskManager()
+{
+    StopAllTasks();
+}
+
+void TaskManager::StartTask(Task task)
+{
+    Task::Handle handle = task.Release();
+    if (handle)
+        tasks_.push_back(handle);
+}
+
+void TaskManager::StopAllTasks()
+{
+    for (auto handle : tasks_)
+    {
+        ClearTaskWait(handle.promise().wait);
+        handle.promise().stopped = true;
+    }
+
+    // A running task can not be destroyed, it will be removed after the update
+    if (!updating_)
+        RemoveStoppedTasks();
+}
+
+size_t TaskManager::GetTasksCount() const
+{
+    return tasks_.size();
+}
+
+void TaskManager::UpdateTasks(Actor* target, Duration dt)
+{
+    if (tasks_.empty())
+        return;
+
+    updating_ = true;
+
+    // Tasks started during the update will be resumed on the next update
+    const size_t count = tasks_.size();
+    for (size_t i = 0; i < count; ++i)
+    {
+        Task::Handle        handle  = tasks_[i];
+        Task::promise_type& promise = handle.promise();
+
+        if (promise.stopped || handle.done() || !IsTaskReady(promise.wait, dt))
+            continue;
+
+        ClearTaskWait(promise.wait);
+
+        promise.target = target;
+        handle.resume();
+    }
+
+    updating_ = false;
+
+    RemoveStoppedTasks();
+}
+
+void TaskManager::RemoveStoppedTasks()
+{
+    for (size_t i = tasks_.size(); i > 0; --i)
+    {
+        Task::Handle handle = tasks_[i - 1];
+        if (handle.promise().stopped || handle.done())
+        {
+            ClearTaskWait(handle.promise().wait);
+            handle.destroy();
+            tasks_.erase(tasks_.begin() + (i - 1));
+        }
+    }
+}
+
+#else
+
+TaskManager::TaskManager() {}
+
+TaskManager::~TaskManager() {}
+
+void TaskManager::UpdateTasks(Actor* target, Duration dt) {}
+
+#endif
+}  // namespace kiwano
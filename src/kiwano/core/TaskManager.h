@@ -0,0 +1,69 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+#include <kiwano/core/Task.h>
+
+namespace kiwano
+{
+class Actor;
+
+/**
+ * \~chinese
+ * @brief 协程任务管理器
+ * @details 需要编译器支持 C++20 协程，否则不提供任何任务功能
+ */
+class KGE_API TaskManager
+{
+public:
+    TaskManager();
+
+    ~TaskManager();
+
+#ifdef KGE_HAS_COROUTINE
+    /// \~chinese
+    /// @brief 启动协程任务
+    /// @details 任务在下一次更新时开始执行
+    void StartTask(Task task);
+
+    /// \~chinese
+    /// @brief 停止所有协程任务
+    void StopAllTasks();
+
+    /// \~chinese
+    /// @brief 获取协程任务数量
+    size_t GetTasksCount() const;
+#endif
+
+protected:
+    /// \~chinese
+    /// @brief 恢复等待条件已满足的协程任务
+    void UpdateTasks(Actor* target, Duration dt);
+
+private:
+#ifdef KGE_HAS_COROUTINE
+    void RemoveStoppedTasks();
+
+    bool                 updating_;
+    Vector<Task::Handle> tasks_;
+#endif
+};
+}  // namespace kiwano
@@ -0,0 +1,152 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <kiwano/core/Logger.h>
+#include <kiwano/core/ThreadPool.h>
+
+namespace kiwano
+{
+
+ThreadPool::ThreadPool()
+    : stopping_(false)
+    , thread_count_(std::max(std::thread::hardware_concurrency(), 2u) - 1)
+{
+}
+
+ThreadPool::~ThreadPool()
+{
+    Shutdown();
+}
+
+void ThreadPool::Submit(Task task)
+{
+    {
+        // Function is not thread-safe reference counted, the queue must hold the only reference
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push(std::move(task));
+        StartThreads();
+    }
+    cond_.notify_one();
+}
+
+void ThreadPool::SubmitBackground(Task task)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        background_tasks_.push(std::move(task));
+        StartThreads();
+    }
+    cond_.notify_one();
+}
+
+bool ThreadPool::RunPendingTask()
+{
+    Task task;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tasks_.empty())
+            return false;
+
+        task = std::move(tasks_.front());
+        tasks_.pop();
+    }
+
+    RunTask(task);
+    return true;
+}
+
+void ThreadPool::StartThreads()
+{
+    if (threads_.empty())
+    {
+        stopping_ = false;
+        for (uint32_t i = 0; i < thread_count_; ++i)
+        {
+            threads_.emplace_back(Closure(this, &ThreadPool::WorkerThread));
+        }
+    }
+}
+
+void ThreadPool::SetThreadCount(uint32_t count)
+{
+    Shutdown();
+    thread_count_ = std::max(count, 1u);
+}
+
+void ThreadPool::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cond_.notify_all();
+
+    for (auto& thread : threads_)
+    {
+        if (thread.joinable())
+            thread.join();
+    }
+    threads_.clear();
+}
+
+void ThreadPool::WorkerThread()
+{
+    while (true)
+    {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cond_.wait(lock, [this]() { return stopping_ || !tasks_.empty() || !background_tasks_.empty(); });
+
+            // Tasks of the current frame go first
+            Queue<Task>& queue = tasks_.empty() ? background_tasks_ : tasks_;
+            if (queue.empty())
+                return;
+
+            task = std::move(queue.front());
+            queue.pop();
+        }
+
+        RunTask(task);
+    }
+}
+
+void ThreadPool::RunTask(Task const& task)
+{
+    if (!task)
+        return;
+
+    // An exception escaping a worker thread would terminate the process
+    try
+    {
+        task();
+    }
+    catch (std::exception& e)
+    {
+        KGE_ERROR(L"Unhandled exception in thread pool task: %s", oc::string_to_wide(e.what()).c_str());
+    }
+    catch (...)
+    {
+        KGE_ERROR(L"Unhandled exception in thread pool task");
+    }
+}
+
+}  // namespace kiwano
@@ -0,0 +1,101 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+#include <kiwano/core/Common.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace kiwano
+{
+/**
+ * \~chinese
+ * @brief 线程池
+ * @details 工作线程在第一次提交任务时创建，默认数量为处理器核心数减一。
+ * 任务分为两个队列：需要在当前帧内完成的任务和耗时较长的后台任务，工作线程总是优先执行前者
+ */
+class KGE_API ThreadPool : public Singleton<ThreadPool>
+{
+    friend Singleton<ThreadPool>;
+
+public:
+    /// \~chinese
+    /// @brief 任务
+    using Task = Function<void()>;
+
+    /// \~chinese
+    /// @brief 提交任务
+    /// @details 任务在工作线程中执行，不保证执行顺序。用于需要在当前帧内完成的短任务，
+    /// 等待任务完成的线程可以通过 RunPendingTask 协助执行
+    void Submit(Task task);
+
+    /// \~chinese
+    /// @brief 提交后台任务
+    /// @details 用于资源加载等耗时较长的任务，只有在没有等待执行的普通任务时才会被工作线程执行
+    void SubmitBackground(Task task);
+
+    /// \~chinese
+    /// @brief 在当前线程中执行一个等待执行的普通任务
+    /// @details 不会执行后台任务
+    /// @return 没有等待执行的普通任务时返回 false
+    bool RunPendingTask();
+
+    /// \~chinese
+    /// @brief 设置工作线程数量
+    /// @details 已创建的工作线程会在执行完所有任务后结束，新的工作线程在下一次提交任务时创建
+    void SetThreadCount(uint32_t count);
+
+    /// \~chinese
+    /// @brief 获取工作线程数量
+    uint32_t GetThreadCount() const;
+
+    /// \~chinese
+    /// @brief 执行完所有已提交的任务并结束工作线程
+    void Shutdown();
+
+private:
+    ThreadPool();
+
+    ~ThreadPool();
+
+    void StartThreads();
+
+    void WorkerThread();
+
+    static void RunTask(Task const& task);
+
+private:
+    bool                    stopping_;
+    uint32_t                thread_count_;
+    std::mutex              mutex_;
+    std::condition_variable cond_;
+    Queue<Task>             tasks_;
+    Queue<Task>             background_tasks_;
+    List<std::thread>       threads_;
+};
+
+inline uint32_t ThreadPool::GetThreadCount() const
+{
+    return thread_count_;
+}
+
+}  // namespace kiwano
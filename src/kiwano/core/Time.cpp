@@ -83,6 +83,22 @@ Time Time::Now() noexcept
     return Time{ static_cast<long>(whole + part) };
 }
 
+int64_t Time::NowMicroseconds() noexcept
+{
+    static LARGE_INTEGER freq = {};
+    if (freq.QuadPart == 0LL)
+    {
+        QueryPerformanceFrequency(&freq);
+    }
+
+    LARGE_INTEGER count;
+    QueryPerformanceCounter(&count);
+
+    const long long whole = (count.QuadPart / freq.QuadPart) * 1000000LL;
+    const long long part  = (count.QuadPart % freq.QuadPart) * 1000000LL / freq.QuadPart;
+    return static_cast<int64_t>(whole + part);
+}
+
 //-------------------------------------------------------
 // Duration
 //-------------------------------------------------------
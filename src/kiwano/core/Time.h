@@ -183,6 +183,11 @@ struct KGE_API Time
     /// @brief 获取当前时间
     static Time Now() noexcept;
 
+    /// \~chinese
+    /// @brief 获取当前的高精度时间戳
+    /// @details 与 Now 使用相同的时钟，单位为微秒，用于比较毫秒以下的时间间隔
+    static int64_t NowMicroseconds() noexcept;
+
     const Duration operator-(const Time&) const;
 
     const Time operator+(const Duration&) const;
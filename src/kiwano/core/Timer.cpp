@@ -19,6 +19,7 @@
 // THE SOFTWARE.
 
 #include <kiwano/core/Timer.h>
+#include <kiwano/core/TimerManager.h>
 
 namespace kiwano
 {
@@ -53,37 +54,57 @@ Timer::Timer()
     , removeable_(false)
     , run_times_(0)
     , total_times_(0)
+    , version_(0)
     , interval_(0)
     , elapsed_(0)
+    , last_time_(0)
+    , owner_(nullptr)
     , callback_()
 {
 }
 
-void Timer::Update(Duration dt)
+void Timer::Start()
 {
-    if (total_times_ == 0)
-    {
-        Remove();
+    if (running_)
         return;
-    }
 
-    if (IsRunning())
+    running_ = true;
+    if (owner_)
     {
-        if (!interval_.IsZero())
-        {
-            elapsed_ += dt;
-            if (elapsed_ < interval_)
-                return;
-        }
+        last_time_ = owner_->now_;
+        owner_->ScheduleTimer(this);
+    }
+}
+
+void Timer::Stop()
+{
+    if (!running_)
+        return;
+
+    SyncElapsed();
+    running_ = false;
+    ++version_;
+}
+
+void Timer::Remove()
+{
+    if (removeable_)
+        return;
 
-        if (callback_)
-            callback_(this, elapsed_);
+    removeable_ = true;
+    ++version_;
 
-        ++run_times_;
-        elapsed_ = 0;
+    if (owner_)
+        owner_->has_removed_ = true;
+}
 
-        if (run_times_ == total_times_)
-            Remove();
+void Timer::SetInterval(Duration interval)
+{
+    interval_ = interval;
+    if (running_ && owner_)
+    {
+        SyncElapsed();
+        owner_->ScheduleTimer(this);
     }
 }
 
@@ -93,4 +114,13 @@ void Timer::Reset()
     run_times_ = 0;
 }
 
+void Timer::SyncElapsed()
+{
+    if (owner_ && running_)
+    {
+        elapsed_ += owner_->now_ - last_time_;
+        last_time_ = owner_->now_;
+    }
+}
+
 }  // namespace kiwano
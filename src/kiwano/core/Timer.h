@@ -30,7 +30,8 @@ KGE_DECLARE_SMART_PTR(Timer);
 
 /// \~chinese
 /// @brief 定时器
-/// @details 定时器用于每隔一段时间执行一次回调函数，且可以指定执行总次数
+/// @details 定时器用于每隔一段时间执行一次回调函数，且可以指定执行总次数。
+/// 定时器按到期时间由 TimerManager 调度，未到期的定时器在更新时不会被访问
 class KGE_API Timer
     : public virtual ObjectBase
     , protected IntrusiveListItem<TimerPtr>
@@ -113,39 +114,27 @@ public:
     void SetCallback(const Callback& callback);
 
 private:
-    /// \~chinese
-    /// @brief 更新定时器
-    void Update(Duration dt);
-
     /// \~chinese
     /// @brief 重置定时器
     void Reset();
 
+    /// \~chinese
+    /// @brief 将运行时间累加到当前时刻
+    void SyncElapsed();
+
 private:
-    bool     running_;
-    bool     removeable_;
-    int      run_times_;
-    int      total_times_;
-    Duration interval_;
-    Duration elapsed_;
-    Callback callback_;
+    bool          running_;
+    bool          removeable_;
+    int           run_times_;
+    int           total_times_;
+    uint32_t      version_;
+    Duration      interval_;
+    Duration      elapsed_;
+    Duration      last_time_;
+    TimerManager* owner_;
+    Callback      callback_;
 };
 
-inline void Timer::Start()
-{
-    running_ = true;
-}
-
-inline void Timer::Stop()
-{
-    running_ = false;
-}
-
-inline void Timer::Remove()
-{
-    removeable_ = true;
-}
-
 inline bool Timer::IsRunning() const
 {
     return running_;
@@ -176,11 +165,6 @@ inline Duration Timer::GetInterval() const
     return interval_;
 }
 
-inline void Timer::SetInterval(Duration interval)
-{
-    interval_ = interval;
-}
-
 inline Timer::Callback Timer::GetCallback() const
 {
     return callback_;
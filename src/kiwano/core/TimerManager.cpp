@@ -18,26 +18,145 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <algorithm>
 #include <kiwano/core/Logger.h>
+#include <kiwano/core/Profiler.h>
 #include <kiwano/core/TimerManager.h>
 
 namespace kiwano
 {
+namespace
+{
+
+struct LaterDeadline
+{
+    template <typename _Ty>
+    bool operator()(_Ty const& lhs, _Ty const& rhs) const
+    {
+        return lhs.deadline > rhs.deadline;
+    }
+};
+
+}  // namespace
+
+TimerManager::TimerManager()
+    : has_removed_(false)
+    , now_(0)
+{
+}
+
+TimerManager::~TimerManager()
+{
+    RemoveAllTimers();
+}
+
 void TimerManager::UpdateTimers(Duration dt)
 {
-    if (timers_.empty())
+    now_ += dt;
+
+    if (queue_.empty() || queue_.begin()->deadline > now_)
+    {
+        if (has_removed_)
+            PurgeRemovedTimers();
         return;
+    }
+
+    // Take all due timers out first, timers rescheduled by callbacks will not run again in this update
+    due_.clear();
+    while (!queue_.empty() && queue_.begin()->deadline <= now_)
+    {
+        std::pop_heap(queue_.begin(), queue_.end(), LaterDeadline());
+        due_.push_back(queue_.back());
+        queue_.pop_back();
+    }
+
+    uint32_t ticked = 0;
+    for (auto& entry : due_)
+    {
+        Timer* timer = entry.timer.get();
+        if (entry.version != timer->version_)
+            continue;
+
+        ++ticked;
+
+        if (timer->total_times_ == 0)
+        {
+            timer->Remove();
+            continue;
+        }
+
+        Duration elapsed  = timer->elapsed_ + (now_ - timer->last_time_);
+        timer->elapsed_   = 0;
+        timer->last_time_ = now_;
+
+        if (timer->callback_)
+            timer->callback_(timer, elapsed);
+
+        ++timer->run_times_;
+
+        if (timer->run_times_ == timer->total_times_)
+            timer->Remove();
+        else if (entry.version == timer->version_)
+            ScheduleTimer(timer);
+    }
+    due_.clear();
+
+    if (has_removed_)
+        PurgeRemovedTimers();
+
+    Profiler& profiler = Profiler::Instance();
+    if (profiler.IsEnabled())
+        profiler.IncreaseTimersTicked(ticked);
+}
+
+void TimerManager::ScheduleTimer(Timer* timer)
+{
+    ++timer->version_;
+    timer->last_time_ = now_;
+
+    Duration remaining = timer->interval_ - timer->elapsed_;
+    if (remaining < 0)
+        remaining = 0;
+
+    queue_.push_back(ScheduledTimer{ now_ + remaining, timer->version_, timer });
+    std::push_heap(queue_.begin(), queue_.end(), LaterDeadline());
+
+    // Each timer has at most one valid record, restarting a timer leaves the old one stale
+    if (queue_.size() > timers_.size() * 2 + 16)
+        CompactQueue();
+}
+
+void TimerManager::CompactQueue()
+{
+    size_t count = 0;
+    for (auto& entry : queue_)
+    {
+        if (entry.version == entry.timer->version_)
+            queue_.begin()[count++] = entry;
+    }
+    queue_.resize(count);
+    std::make_heap(queue_.begin(), queue_.end(), LaterDeadline());
+}
+
+void TimerManager::PurgeRemovedTimers()
+{
+    has_removed_ = false;
 
     TimerPtr next;
     for (auto timer = timers_.first_item(); timer; timer = next)
     {
         next = timer->next_item();
 
-        timer->Update(dt);
-
         if (timer->IsRemoveable())
+        {
+            timer->owner_ = nullptr;
             timers_.remove(timer);
+        }
     }
+
+    // Drop stale records which keep removed timers alive
+    if (queue_.size() > timers_.size() * 2 + 16)
+        CompactQueue();
 }
 
 Timer* TimerManager::AddTimer(Timer::Callback const& cb, Duration interval, int times)
@@ -58,7 +177,12 @@ Timer* TimerManager::AddTimer(TimerPtr timer)
     if (timer)
     {
         timer->Reset();
+        timer->owner_     = this;
+        timer->last_time_ = now_;
         timers_.push_back(timer);
+
+        if (timer->IsRunning())
+            ScheduleTimer(timer.get());
     }
 
     return timer.get();
@@ -130,7 +254,15 @@ void TimerManager::StartAllTimers()
 
 void TimerManager::RemoveAllTimers()
 {
+    for (auto& timer : timers_)
+    {
+        ++timer.version_;
+        timer.owner_ = nullptr;
+    }
+
+    has_removed_ = false;
     timers_.clear();
+    queue_.clear();
 }
 
 const TimerManager::Timers& TimerManager::GetAllTimers() const
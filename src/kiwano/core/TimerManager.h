@@ -29,11 +29,17 @@ namespace kiwano
  */
 class KGE_API TimerManager
 {
+    friend class Timer;
+
 public:
     /// \~chinese
     /// @brief 定时器列表
     using Timers = IntrusiveList<TimerPtr>;
 
+    TimerManager();
+
+    ~TimerManager();
+
     /// \~chinese
     /// @brief 添加定时器
     /// @param cb 回调函数
@@ -84,9 +90,36 @@ public:
 protected:
     /// \~chinese
     /// @brief 更新定时器
+    /// @details 只执行已到期的定时器，耗时与定时器总数无关
     void UpdateTimers(Duration dt);
 
 private:
-    Timers timers_;
+    /// \~chinese
+    /// @brief 按定时器剩余时间将其加入到期队列
+    void ScheduleTimer(Timer* timer);
+
+    /// \~chinese
+    /// @brief 从列表中删除已移除的定时器
+    void PurgeRemovedTimers();
+
+    /// \~chinese
+    /// @brief 丢弃到期队列中失效的记录
+    void CompactQueue();
+
+    /// \~chinese
+    /// @brief 到期队列中的定时器
+    /// @details 定时器被停止、移除或重新调度后，队列中旧的记录会因版本号不一致而被丢弃
+    struct ScheduledTimer
+    {
+        Duration deadline;
+        uint32_t version;
+        TimerPtr timer;
+    };
+
+    bool                   has_removed_;
+    Duration               now_;
+    Timers                 timers_;
+    Vector<ScheduledTimer> queue_;
+    Vector<ScheduledTimer> due_;
 };
 }  // namespace kiwano
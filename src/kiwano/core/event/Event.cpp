@@ -1,12 +1,38 @@
 #include <kiwano/core/event/Event.h>
+#include <kiwano/core/ObjectPool.h>
 
 namespace kiwano
 {
 Event::Event(EventType const& type)
     : type_(type)
+    , timestamp_(0)
 {
 }
 
 Event::~Event() {}
 
+void* Event::operator new(size_t size)
+{
+    void* ptr = ObjectPool::Allocate(size);
+    if (!ptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* Event::operator new(size_t size, std::nothrow_t const&) noexcept
+{
+    return ObjectPool::Allocate(size);
+}
+
+void Event::operator delete(void* ptr, size_t size) noexcept
+{
+    ObjectPool::Free(ptr, size);
+}
+
+void Event::operator delete(void* ptr, std::nothrow_t const&) noexcept
+{
+    // Only called when a constructor throws, the block is not cached
+    ::operator delete(ptr);
+}
+
 }  // namespace kiwano
@@ -22,6 +22,7 @@
 #include <kiwano/core/SmartPtr.hpp>
 #include <kiwano/core/event/EventType.h>
 #include <kiwano/math/Math.h>
+#include <typeinfo>
 
 namespace kiwano
 {
@@ -39,6 +40,8 @@ KGE_DECLARE_SMART_PTR(Event);
 
 /// \~chinese
 /// @brief 事件
+/// @details 事件对象的内存由内存池缓存，频繁创建事件时不会反复向系统申请内存。
+/// 仅在分发过程中使用的事件可以直接在栈上创建并以指针分发，此时事件监听器不得持有该事件的智能指针
 class KGE_API Event : public RefCounter
 {
 public:
@@ -52,6 +55,16 @@ public:
     /// @brief 获取类型事件
     const EventType& GetType() const;
 
+    /// \~chinese
+    /// @brief 获取事件时间戳
+    /// @details 窗口事件在放入事件队列时记录时间戳，单位为微秒
+    /// @see Time::NowMicroseconds
+    int64_t GetTimestamp() const;
+
+    /// \~chinese
+    /// @brief 设置事件时间戳
+    void SetTimestamp(int64_t timestamp);
+
     /// \~chinese
     /// @brief 判断事件类型
     /// @return 是否是指定事件类型
@@ -70,8 +83,20 @@ public:
     template <typename _Ty, typename = typename std::enable_if<std::is_base_of<Event, _Ty>::value, int>::type>
     _Ty* SafeCast();
 
+    /// \~chinese
+    /// @brief 从内存池中申请内存
+    /// @see ObjectPool
+    static void* operator new(size_t size);
+
+    static void* operator new(size_t size, std::nothrow_t const&) noexcept;
+
+    static void operator delete(void* ptr, size_t size) noexcept;
+
+    static void operator delete(void* ptr, std::nothrow_t const&) noexcept;
+
 private:
     const EventType type_;
+    int64_t         timestamp_;
 };
 
 /// \~chinese
@@ -99,6 +124,16 @@ inline const EventType& Event::GetType() const
     return type_;
 }
 
+inline int64_t Event::GetTimestamp() const
+{
+    return timestamp_;
+}
+
+inline void Event::SetTimestamp(int64_t timestamp)
+{
+    timestamp_ = timestamp;
+}
+
 template <typename _Ty, typename>
 inline bool Event::IsType() const
 {
@@ -116,7 +151,7 @@ inline _Ty* Event::SafeCast()
 {
     if (!IsType<_Ty>())
         throw std::bad_cast();
-    return dynamic_cast<_Ty*>(this);
+    return static_cast<_Ty*>(this);
 }
 
 }  // namespace kiwano
@@ -20,8 +20,6 @@
 
 #pragma once
 #include <kiwano/core/Common.h>
-#include <typeindex>
-#include <typeinfo>
 
 namespace kiwano
 {
@@ -32,33 +30,110 @@ namespace kiwano
 
 /// \~chinese
 /// @brief 事件类型
-class EventType : public std::type_index
+/// @details 事件类型使用编译期计算的整数标识，比较操作的开销与整数比较相同，且不依赖 RTTI
+class EventType
 {
-    class Dummy
+public:
+    /// \~chinese
+    /// @brief 事件类型标识
+    typedef uint32_t IdType;
+
+    /// \~chinese
+    /// @brief 构建空事件类型
+    constexpr EventType()
+        : id_(0)
     {
-    };
+    }
 
-public:
     /// \~chinese
     /// @brief 构建事件类型
-    EventType();
-
-    using std::type_index::type_index;
-    using std::type_index::operator==;
-    using std::type_index::operator!=;
-    using std::type_index::operator<;
-    using std::type_index::operator>=;
-    using std::type_index::operator>;
-    using std::type_index::operator<=;
+    /// @param id 事件类型标识
+    constexpr explicit EventType(IdType id)
+        : id_(id)
+    {
+    }
+
+    /// \~chinese
+    /// @brief 获取事件类型标识
+    constexpr IdType GetId() const
+    {
+        return id_;
+    }
+
+    /// \~chinese
+    /// @brief 获取指定事件的类型
+    /// @details 标识由类型名称的哈希值得到，在不同模块（如 DLL 与可执行文件）中保持一致
+    template <typename _Ty>
+    static constexpr EventType Of()
+    {
+        return EventType(std::integral_constant<IdType, TypeHash<_Ty>()>::value);
+    }
+
+    constexpr bool operator==(const EventType& rhs) const
+    {
+        return id_ == rhs.id_;
+    }
+
+    constexpr bool operator!=(const EventType& rhs) const
+    {
+        return id_ != rhs.id_;
+    }
+
+    constexpr bool operator<(const EventType& rhs) const
+    {
+        return id_ < rhs.id_;
+    }
+
+    constexpr bool operator>(const EventType& rhs) const
+    {
+        return id_ > rhs.id_;
+    }
+
+    constexpr bool operator<=(const EventType& rhs) const
+    {
+        return id_ <= rhs.id_;
+    }
+
+    constexpr bool operator>=(const EventType& rhs) const
+    {
+        return id_ >= rhs.id_;
+    }
+
+private:
+    // FNV-1a
+    static constexpr IdType Hash(const char* str, IdType hash = 2166136261u)
+    {
+        return (*str == '\0') ? hash : Hash(str + 1, (hash ^ IdType(static_cast<unsigned char>(*str))) * 16777619u);
+    }
+
+    template <typename _Ty>
+    static constexpr IdType TypeHash()
+    {
+#if defined(_MSC_VER)
+        return Hash(__FUNCSIG__);
+#else
+        return Hash(__PRETTY_FUNCTION__);
+#endif
+    }
+
+private:
+    IdType id_;
 };
 
 /** @} */
 
-#define KGE_EVENT(EVENT_TYPE) ::kiwano::EventType(typeid(EVENT_TYPE))
-
-inline EventType::EventType()
-    : std::type_index(typeid(EventType::Dummy))
-{
-}
+#define KGE_EVENT(EVENT_TYPE) ::kiwano::EventType::Of<EVENT_TYPE>()
 
 }  // namespace kiwano
+
+namespace std
+{
+template <>
+struct hash<::kiwano::EventType>
+{
+    inline size_t operator()(const ::kiwano::EventType& type) const
+    {
+        return static_cast<size_t>(type.GetId());
+    }
+};
+}  // namespace std
@@ -50,8 +50,13 @@
 #include <kiwano/core/EventListener.h>
 #include <kiwano/core/Logger.h>
 #include <kiwano/core/ObjectBase.h>
+#include <kiwano/core/ObjectPool.h>
+#include <kiwano/core/Profiler.h>
 #include <kiwano/core/Resource.h>
 #include <kiwano/core/SmartPtr.hpp>
+#include <kiwano/core/Task.h>
+#include <kiwano/core/TaskManager.h>
+#include <kiwano/core/ThreadPool.h>
 #include <kiwano/core/Time.h>
 #include <kiwano/core/Timer.h>
 #include <kiwano/core/TimerManager.h>
@@ -71,6 +76,8 @@
 #include <kiwano/render/Texture.h>
 #include <kiwano/render/GifImage.h>
 #include <kiwano/render/LayerArea.h>
+#include <kiwano/render/DamageRegion.h>
+#include <kiwano/render/FlattenedPath.h>
 #include <kiwano/render/TextLayout.h>
 #include <kiwano/render/TextureCache.h>
 #include <kiwano/render/Renderer.h>
@@ -90,6 +97,7 @@
 #include <kiwano/2d/ShapeActor.h>
 #include <kiwano/2d/Sprite.h>
 #include <kiwano/2d/Stage.h>
+#include <kiwano/2d/StageLoader.h>
 #include <kiwano/2d/TextActor.h>
 #include <kiwano/2d/Transition.h>
 #include <kiwano/2d/action/Action.h>
@@ -97,9 +105,13 @@
 #include <kiwano/2d/action/ActionGroup.h>
 #include <kiwano/2d/action/ActionHelper.h>
 #include <kiwano/2d/action/ActionManager.h>
+#include <kiwano/2d/action/ActionProgram.h>
 #include <kiwano/2d/action/ActionTween.h>
 #include <kiwano/2d/action/ActionWalk.h>
 #include <kiwano/2d/action/Animation.h>
+#include <kiwano/2d/action/AnimationClip.h>
+#include <kiwano/2d/action/EaseCurve.h>
+#include <kiwano/2d/action/TweenSystem.h>
 
 //
 // platform
@@ -108,6 +120,7 @@
 #include <kiwano/platform/Application.h>
 #include <kiwano/platform/FileSystem.h>
 #include <kiwano/platform/Input.h>
+#include <kiwano/platform/Replay.h>
 #include <kiwano/platform/Window.h>
 
 //
@@ -116,4 +129,5 @@
 
 #include <kiwano/utils/LocalStorage.h>
 #include <kiwano/utils/ResourceCache.h>
+#include <kiwano/utils/SceneFile.h>
 #include <kiwano/utils/UserData.h>
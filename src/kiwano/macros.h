@@ -100,6 +100,11 @@
 #define KGE_DEBUG
 #endif
 
+// C++20 coroutines, requires /std:c++latest or above
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+#define KGE_HAS_COROUTINE
+#endif
+
 #define KGE_SUPPRESS_WARNING_PUSH __pragma(warning(push))
 #define KGE_SUPPRESS_WARNING(CODE) __pragma(warning(disable : CODE))
 #define KGE_SUPPRESS_WARNING_POP __pragma(warning(pop))
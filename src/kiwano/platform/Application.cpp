@@ -20,11 +20,17 @@
 
 #include <kiwano/core/Director.h>
 #include <kiwano/core/Logger.h>
+#include <kiwano/core/ThreadPool.h>
 #include <kiwano/platform/Application.h>
 #include <kiwano/platform/Input.h>
 #include <kiwano/render/TextureCache.h>
 #include <kiwano/utils/ResourceCache.h>
+#include <algorithm>
+#include <mmsystem.h>  // timeBeginPeriod
 #include <mutex>
+#include <thread>
+
+#pragma comment(lib, "winmm.lib")
 
 namespace kiwano
 {
@@ -35,23 +41,95 @@ using FunctionToPerform = Function<void()>;
 
 std::mutex               perform_mutex_;
 Queue<FunctionToPerform> functions_to_perform_;
+Application*             current_app_ = nullptr;
+
+struct LowerJobPriority
+{
+    template <typename _Ty>
+    bool operator()(_Ty const& lhs, _Ty const& rhs) const
+    {
+        if (lhs.priority != rhs.priority)
+            return lhs.priority < rhs.priority;
+        return lhs.order > rhs.order;
+    }
+};
+
+class UpdateLatch
+{
+public:
+    UpdateLatch(size_t count)
+        : count_(count)
+    {
+    }
+
+    void CountDown(std::exception_ptr error)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (error && !error_)
+            error_ = error;
+        if (--count_ == 0)
+            cond_.notify_one();
+    }
+
+    void Wait()
+    {
+        // Run queued update tasks here instead of blocking behind workers busy with other work
+        while (!IsDone() && ThreadPool::Instance().RunPendingTask())
+            ;
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_.wait(lock, [this]() { return count_ == 0; });
+
+        if (error_)
+            std::rethrow_exception(error_);
+    }
+
+private:
+    bool IsDone()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return count_ == 0;
+    }
+
+private:
+    size_t                  count_;
+    std::exception_ptr      error_;
+    std::mutex              mutex_;
+    std::condition_variable cond_;
+};
 
 }  // namespace
 
 Application::Application()
-    : time_scale_(1.f)
+    : idle_(false)
+    , time_scale_(1.f)
+    , max_frame_rate_(0)
+    , idle_frame_rate_(0)
+    , idle_timeout_(0)
+    , last_activity_time_(0)
+    , sleep_time_(0)
+    , total_sleep_time_(0)
+    , job_order_(0)
+    , job_overrun_count_(0)
+    , job_time_(0)
+    , job_budget_(4)
 {
     Use(&Renderer::Instance());
     Use(&Input::Instance());
     Use(&Director::Instance());
+
+    current_app_ = this;
 }
 
 Application::~Application()
 {
     Destroy();
+
+    if (current_app_ == this)
+        current_app_ = nullptr;
 }
 
-void Application::Run(bool debug)
+void Application::Setup(bool debug)
 {
     // Setup all components
     for (auto c : comps_)
@@ -67,19 +145,133 @@ void Application::Run(bool debug)
 
     // Everything is ready
     OnReady();
+}
 
-    last_update_time_ = Time::Now();
+void Application::Run(bool debug)
+{
+    Setup(debug);
+
+    last_update_time_   = Time::Now();
+    last_activity_time_ = Time::NowMicroseconds();
 
     Window& window = Window::Instance();
     while (!window.ShouldClose())
     {
+        const int64_t frame_start = Time::NowMicroseconds();
+
         while (EventPtr evt = window.PollEvent())
         {
             DispatchEvent(evt.get());
+            last_activity_time_ = frame_start;
         }
 
         Update();
+        RunJobs();
         Render();
+
+        WaitForNextFrame(frame_start);
+    }
+}
+
+void Application::WaitForNextFrame(int64_t frame_start)
+{
+    // Even with 1ms timer resolution Sleep() may overshoot a little, so the last part of the wait is spun
+    const int64_t spin_time = 2000;
+
+    int64_t now = Time::NowMicroseconds();
+    if (Director::Instance().IsAnimating())
+    {
+        last_activity_time_ = now;
+    }
+
+    idle_ = false;
+    if (idle_frame_rate_)
+    {
+        const int64_t timeout = int64_t(idle_timeout_.Milliseconds()) * 1000;
+
+        idle_ = Window::Instance().IsMinimized() || (timeout > 0 && now - last_activity_time_ >= timeout);
+    }
+
+    sleep_time_ = 0;
+
+    const uint32_t fps = idle_ ? idle_frame_rate_ : max_frame_rate_;
+    if (fps == 0)
+        return;
+
+    const int64_t deadline = frame_start + 1000000 / fps;
+    if (now >= deadline)
+        return;
+
+    const int64_t start = now;
+    if (deadline - now > spin_time)
+    {
+        // The default timer resolution is about 15.6ms, which is longer than a frame
+        ::timeBeginPeriod(1);
+        std::this_thread::sleep_for(std::chrono::microseconds(deadline - now - spin_time));
+        ::timeEndPeriod(1);
+    }
+
+    while ((now = Time::NowMicroseconds()) < deadline)
+    {
+        std::this_thread::yield();
+    }
+
+    sleep_time_ = now - start;
+    total_sleep_time_ += sleep_time_;
+}
+
+void Application::Replay(ReplayPlayerPtr player, bool headless, bool debug)
+{
+    KGE_ASSERT(player && "Replay failed, player is null");
+
+    Setup(debug);
+
+    Renderer& renderer = Renderer::Instance();
+    bool      vsync    = renderer.IsVSyncEnabled();
+    renderer.SetVSyncEnabled(false);
+
+    player->Rewind();
+
+    Window&          window = Window::Instance();
+    Vector<EventPtr> events;
+    Duration         dt;
+    int64_t          total_cost = 0;
+    int64_t          max_cost   = 0;
+
+    while (!window.ShouldClose() && player->NextFrame(events, dt))
+    {
+        // Keep the window responsive, live input is ignored while replaying
+        while (window.PollEvent())
+            ;
+
+        const int64_t start = Time::NowMicroseconds();
+
+        for (auto& evt : events)
+        {
+            DispatchEvent(evt.get());
+        }
+
+        Update(dt);
+        RunJobs();
+
+        if (!headless)
+        {
+            Render();
+        }
+
+        const int64_t cost = Time::NowMicroseconds() - start;
+        player->AddFrameCost(cost);
+
+        total_cost += cost;
+        max_cost = std::max(max_cost, cost);
+    }
+
+    renderer.SetVSyncEnabled(vsync);
+
+    const uint32_t frames = player->GetPlayedFrameCount();
+    if (frames)
+    {
+        KGE_LOG(L"Replay finished:", frames, L"frames, average", total_cost / frames, L"us, max", max_cost, L"us");
     }
 }
 
@@ -90,6 +282,9 @@ void Application::Quit()
 
 void Application::Destroy()
 {
+    // Stop worker threads before components are destroyed
+    ThreadPool::Instance().Shutdown();
+
     // Clear all resources
     Director::Instance().ClearStages();
     ResourceCache::Instance().Clear();
@@ -135,8 +330,80 @@ void Application::SetTimeScale(float scale_factor)
     time_scale_ = scale_factor;
 }
 
+void Application::AddJob(Job const& job, int priority)
+{
+    if (!job)
+        return;
+
+    jobs_.push_back(ScheduledJob{ priority, job_order_++, 0, job });
+    std::push_heap(jobs_.begin(), jobs_.end(), LowerJobPriority());
+}
+
+void Application::RunJobs()
+{
+    job_time_ = 0;
+    if (jobs_.empty())
+        return;
+
+    const int64_t budget = int64_t(job_budget_.Milliseconds()) * 1000;
+    const int64_t start  = Time::NowMicroseconds();
+
+    while (!jobs_.empty())
+    {
+        // Do not start a job that is expected to exceed the rest of the budget,
+        // but always run at least one job per frame
+        if (job_time_ > 0 && job_time_ + jobs_.front().cost > budget)
+            break;
+
+        // Move the job out of the queue, so it can safely add new jobs
+        std::pop_heap(jobs_.begin(), jobs_.end(), LowerJobPriority());
+        ScheduledJob current = std::move(jobs_.back());
+        jobs_.pop_back();
+
+        const int64_t job_start = Time::NowMicroseconds();
+        const bool    more      = current.job();
+        const int64_t now       = Time::NowMicroseconds();
+
+        if (more)
+        {
+            jobs_.push_back(ScheduledJob{ current.priority, current.order, now - job_start, nullptr });
+            jobs_.back().job = std::move(current.job);
+            std::push_heap(jobs_.begin(), jobs_.end(), LowerJobPriority());
+        }
+
+        job_time_ = now - start;
+        if (job_time_ >= budget)
+            break;
+    }
+
+    if (job_time_ > budget)
+    {
+        ++job_overrun_count_;
+    }
+}
+
+void Application::SetRecorder(ReplayRecorderPtr recorder)
+{
+    recorder_ = recorder;
+}
+
 void Application::Update()
 {
+    const Time     now = Time::Now();
+    const Duration dt  = (now - last_update_time_) * time_scale_;
+
+    last_update_time_ = now;
+
+    Update(dt);
+}
+
+void Application::Update(Duration dt)
+{
+    if (recorder_)
+    {
+        recorder_->RecordFrame(dt);
+    }
+
     // Before update
     for (auto c : update_comps_)
     {
@@ -164,22 +431,148 @@ void Application::Update()
     }
 
     // Updating
+    UpdateComponents(dt);
+
+    // After update
+    for (auto rit = update_comps_.rbegin(); rit != update_comps_.rend(); ++rit)
     {
-        const Time     now = Time::Now();
-        const Duration dt  = (now - last_update_time_) * time_scale_;
+        (*rit)->AfterUpdate();
+    }
+}
+
+void Application::RunUpdate(UpdateComponent* c, Duration dt)
+{
+    c->update_start_ = Time::NowMicroseconds();
+    c->OnUpdate(dt);
+    c->update_cost_ = Time::NowMicroseconds() - c->update_start_;
+}
+
+void Application::UpdateComponents(Duration dt)
+{
+    // Order components so that dependencies come first and registration order breaks ties,
+    // then group them into waves, a component runs after every ordered component it conflicts with
+    const uint32_t unplaced = uint32_t(-1);
+    const size_t   count    = update_comps_.size();
+    uint32_t       max_wave = 0;
+
+    if (count == 0)
+        return;
+
+    update_order_.clear();
+    update_waves_.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        update_waves_[i] = unplaced;
+    }
+
+    while (update_order_.size() < count)
+    {
+        size_t next = count;
+        for (size_t i = 0; i < count && next == count; ++i)
+        {
+            if (update_waves_[i] != unplaced)
+                continue;
+
+            bool ready = true;
+            for (auto dependency : update_comps_[i]->dependencies_)
+            {
+                auto iter = std::find(update_comps_.begin(), update_comps_.end(), dependency);
+                if (iter != update_comps_.end() && update_waves_[iter - update_comps_.begin()] == unplaced)
+                {
+                    ready = false;
+                    break;
+                }
+            }
 
-        last_update_time_ = now;
+            if (ready)
+                next = i;
+        }
 
-        for (auto c : update_comps_)
+        // AddUpdateDependency rejects cycles, but never spin if one slips through
+        for (size_t i = 0; i < count && next == count; ++i)
         {
-            c->OnUpdate(dt);
+            if (update_waves_[i] == unplaced)
+                next = i;
         }
+
+        uint32_t wave = 0;
+        for (auto j : update_order_)
+        {
+            if (update_waves_[j] >= wave && !update_comps_[next]->CanUpdateWith(update_comps_[j]))
+                wave = update_waves_[j] + 1;
+        }
+        update_waves_[next] = wave;
+        max_wave            = std::max(max_wave, wave);
+        update_order_.push_back(next);
     }
 
-    // After update
-    for (auto rit = update_comps_.rbegin(); rit != update_comps_.rend(); ++rit)
+    if (max_wave + 1 == count)
     {
-        (*rit)->AfterUpdate();
+        // Nothing can run concurrently
+        for (auto i : update_order_)
+        {
+            RunUpdate(update_comps_[i], dt);
+        }
+        return;
+    }
+
+    ThreadPool& pool = ThreadPool::Instance();
+    for (uint32_t wave = 0; wave <= max_wave; ++wave)
+    {
+        UpdateComponent* main_comp = nullptr;
+        size_t           workers   = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (update_waves_[i] != wave)
+                continue;
+
+            if (!main_comp)
+                main_comp = update_comps_[i];
+            else
+                ++workers;
+        }
+
+        if (workers == 0)
+        {
+            RunUpdate(main_comp, dt);
+            continue;
+        }
+
+        UpdateLatch latch(workers);
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto c = update_comps_[i];
+            if (update_waves_[i] != wave || c == main_comp)
+                continue;
+
+            pool.Submit([c, dt, &latch]() {
+                std::exception_ptr error;
+                try
+                {
+                    RunUpdate(c, dt);
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+                latch.CountDown(error);
+            });
+        }
+
+        // The first component of each wave always runs on the main thread
+        std::exception_ptr error;
+        try
+        {
+            RunUpdate(main_comp, dt);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        latch.Wait();
+
+        if (error)
+            std::rethrow_exception(error);
     }
 }
 
@@ -209,10 +602,17 @@ void Application::Render()
     }
 
     renderer.Present();
+
+    Input::Instance().OnPresent();
 }
 
 void Application::DispatchEvent(Event* evt)
 {
+    if (recorder_)
+    {
+        recorder_->RecordEvent(evt);
+    }
+
     for (auto c : event_comps_)
     {
         c->HandleEvent(evt);
@@ -225,4 +625,9 @@ void Application::PreformInMainThread(Function<void()> func)
     functions_to_perform_.push(func);
 }
 
+Application* Application::GetCurrent()
+{
+    return current_app_;
+}
+
 }  // namespace kiwano
@@ -26,6 +26,7 @@
 #include <kiwano/core/event/KeyEvent.h>
 #include <kiwano/core/event/MouseEvent.h>
 #include <kiwano/core/event/WindowEvent.h>
+#include <kiwano/platform/Replay.h>
 #include <kiwano/platform/Window.h>
 #include <kiwano/render/Renderer.h>
 
@@ -38,6 +39,13 @@ namespace kiwano
 class KGE_API Application : protected Noncopyable
 {
 public:
+    /**
+     * \~chinese
+     * @brief 分时任务
+     * @details 每次调用执行一小部分工作，返回 true 表示还有剩余工作，返回 false 表示任务已完成
+     */
+    using Job = Function<bool()>;
+
     Application();
 
     virtual ~Application();
@@ -65,6 +73,18 @@ public:
      */
     void Run(bool debug = false);
 
+    /**
+     * \~chinese
+     * @brief 回放录制的运行过程
+     * @details 初始化所有功能组件后执行 OnReady 函数，然后按帧分发回放文件中的事件，并使用录制的帧间隔更新。
+     *          回放时忽略实际的窗口输入并关闭垂直同步，以最快速度运行，每帧耗时记录在回放播放器中
+     * @param player 回放播放器
+     * @param headless 是否跳过渲染
+     * @param debug 是否启用调试模式
+     * @note 该函数是阻塞的，回放结束或窗口关闭时函数返回
+     */
+    void Replay(ReplayPlayerPtr player, bool headless = false, bool debug = false);
+
     /**
      * \~chinese
      * @brief 终止应用程序
@@ -93,6 +113,93 @@ public:
      */
     void SetTimeScale(float scale_factor);
 
+    /**
+     * \~chinese
+     * @brief 设置最大帧率
+     * @details 帧率受限时，每帧结束后先休眠、再以自旋等待的方式精确等待到下一帧开始
+     * @param fps 每秒最大帧数，为 0 时不限制
+     */
+    void SetMaxFrameRate(uint32_t fps);
+
+    /**
+     * \~chinese
+     * @brief 设置空闲策略
+     * @details 窗口最小化时，或超过指定时间没有任何输入和动画时，应用程序进入空闲状态并以较低帧率运行，
+     *          收到输入或有动画播放时立即恢复
+     * @param fps 空闲时每秒的帧数，为 0 时不启用空闲策略
+     * @param timeout 进入空闲状态前无输入和动画的时长，为 0 时仅在窗口最小化时进入空闲状态
+     */
+    void SetIdlePolicy(uint32_t fps, Duration timeout);
+
+    /**
+     * \~chinese
+     * @brief 是否处于空闲状态
+     */
+    bool IsIdle() const;
+
+    /**
+     * \~chinese
+     * @brief 获取上一帧等待的时长（微秒）
+     */
+    int64_t GetSleepTime() const;
+
+    /**
+     * \~chinese
+     * @brief 获取累计等待的时长（微秒）
+     */
+    int64_t GetTotalSleepTime() const;
+
+    /**
+     * \~chinese
+     * @brief 添加分时任务
+     * @details 分时任务在每帧更新之后、渲染之前的主线程中执行，直到用完每帧的时间预算。
+     *          优先级高的任务先执行，优先级相同的任务按添加顺序执行
+     * @param job 分时任务
+     * @param priority 优先级
+     */
+    void AddJob(Job const& job, int priority = 0);
+
+    /**
+     * \~chinese
+     * @brief 设置分时任务每帧的时间预算
+     * @details 每帧至少执行一次任务，即使时间预算为 0。开始执行任务前会根据该任务上一次的耗时判断剩余预算是否足够，
+     * 不足时留到下一帧执行。单次任务调用无法被打断，因此实际耗时仍可能超出预算
+     * @param budget 时间预算，默认为 4 毫秒
+     */
+    void SetJobBudget(Duration budget);
+
+    /**
+     * \~chinese
+     * @brief 获取未完成的分时任务数量
+     */
+    size_t GetJobCount() const;
+
+    /**
+     * \~chinese
+     * @brief 获取上一帧执行分时任务的耗时（微秒）
+     */
+    int64_t GetJobTime() const;
+
+    /**
+     * \~chinese
+     * @brief 获取执行分时任务超出时间预算的帧数
+     */
+    uint32_t GetJobOverrunCount() const;
+
+    /**
+     * \~chinese
+     * @brief 设置回放录制器
+     * @details 设置后每次分发的事件和每帧的帧间隔都将被录制，设置为空时停止录制
+     * @param recorder 回放录制器
+     */
+    void SetRecorder(ReplayRecorderPtr recorder);
+
+    /**
+     * \~chinese
+     * @brief 获取回放录制器
+     */
+    ReplayRecorderPtr GetRecorder() const;
+
     /**
      * \~chinese
      * @brief 分发事件
@@ -109,13 +216,57 @@ public:
      */
     static void PreformInMainThread(Function<void()> func);
 
+    /**
+     * \~chinese
+     * @brief 获取当前的应用程序
+     * @details 没有创建应用程序时返回空指针
+     */
+    static Application* GetCurrent();
+
 private:
+    /**
+     * \~chinese
+     * @brief 初始化所有组件
+     */
+    void Setup(bool debug);
+
     /**
      * \~chinese
      * @brief 更新所有组件
      */
     void Update();
 
+    /**
+     * \~chinese
+     * @brief 以指定的帧间隔更新所有组件
+     */
+    void Update(Duration dt);
+
+    /**
+     * \~chinese
+     * @brief 执行所有组件的 OnUpdate，互不冲突的组件并行执行
+     */
+    void UpdateComponents(Duration dt);
+
+    /**
+     * \~chinese
+     * @brief 执行组件的 OnUpdate 并记录耗时
+     */
+    static void RunUpdate(UpdateComponent* c, Duration dt);
+
+    /**
+     * \~chinese
+     * @brief 按帧率限制和空闲策略等待下一帧
+     * @param frame_start 当前帧的开始时间（微秒）
+     */
+    void WaitForNextFrame(int64_t frame_start);
+
+    /**
+     * \~chinese
+     * @brief 在时间预算内执行分时任务
+     */
+    void RunJobs();
+
     /**
      * \~chinese
      * @brief 渲染所有组件
@@ -123,15 +274,90 @@ private:
     void Render();
 
 private:
+    bool                     idle_;
     float                    time_scale_;
+    uint32_t                 max_frame_rate_;
+    uint32_t                 idle_frame_rate_;
+    Duration                 idle_timeout_;
+    int64_t                  last_activity_time_;
+    int64_t                  sleep_time_;
+    int64_t                  total_sleep_time_;
     Time                     last_update_time_;
+    ReplayRecorderPtr        recorder_;
     Vector<ComponentBase*>   comps_;
     Vector<RenderComponent*> render_comps_;
     Vector<UpdateComponent*> update_comps_;
     Vector<EventComponent*>  event_comps_;
+    Vector<uint32_t>         update_waves_;
+    Vector<size_t>           update_order_;
+
+    struct ScheduledJob
+    {
+        int      priority;
+        uint32_t order;
+        int64_t  cost;  // 上一次执行的耗时（微秒）
+        Job      job;
+    };
+
+    uint32_t             job_order_;
+    uint32_t             job_overrun_count_;
+    int64_t              job_time_;
+    Duration             job_budget_;
+    Vector<ScheduledJob> jobs_;
 };
 
 inline void Application::OnReady() {}
 
 inline void Application::OnDestroy() {}
+
+inline void Application::SetMaxFrameRate(uint32_t fps)
+{
+    max_frame_rate_ = fps;
+}
+
+inline void Application::SetIdlePolicy(uint32_t fps, Duration timeout)
+{
+    idle_frame_rate_ = fps;
+    idle_timeout_    = timeout;
+}
+
+inline bool Application::IsIdle() const
+{
+    return idle_;
+}
+
+inline int64_t Application::GetSleepTime() const
+{
+    return sleep_time_;
+}
+
+inline int64_t Application::GetTotalSleepTime() const
+{
+    return total_sleep_time_;
+}
+
+inline void Application::SetJobBudget(Duration budget)
+{
+    job_budget_ = budget;
+}
+
+inline size_t Application::GetJobCount() const
+{
+    return jobs_.size();
+}
+
+inline int64_t Application::GetJobTime() const
+{
+    return job_time_;
+}
+
+inline uint32_t Application::GetJobOverrunCount() const
+{
+    return job_overrun_count_;
+}
+
+inline ReplayRecorderPtr Application::GetRecorder() const
+{
+    return recorder_;
+}
 }  // namespace kiwano
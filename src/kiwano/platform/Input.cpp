@@ -19,6 +19,7 @@
 // THE SOFTWARE.
 
 #include <kiwano/core/Logger.h>
+#include <kiwano/core/Time.h>
 #include <kiwano/core/event/KeyEvent.h>
 #include <kiwano/core/event/MouseEvent.h>
 #include <kiwano/platform/Input.h>
@@ -28,6 +29,11 @@ namespace kiwano
 Input::Input()
     : want_update_keys_(false)
     , want_update_buttons_(false)
+    , record_begin_(0)
+    , record_end_(0)
+    , oldest_input_time_(0)
+    , pending_input_time_(0)
+    , input_latency_(0)
     , buttons_{}
     , keys_{}
 {
@@ -48,6 +54,53 @@ void Input::AfterUpdate()
         want_update_buttons_ = false;
         buttons_[Prev]       = buttons_[Current];
     }
+
+    // Inputs handled in this frame are presented by the next Present call
+    if (oldest_input_time_ && (!pending_input_time_ || oldest_input_time_ < pending_input_time_))
+    {
+        pending_input_time_ = oldest_input_time_;
+    }
+    oldest_input_time_ = 0;
+    record_begin_      = record_end_;
+}
+
+InputRecord const& Input::GetInputRecord(size_t index) const
+{
+    KGE_ASSERT(index < GetInputRecordCount());
+
+    size_t first = record_end_ - GetInputRecordCount();
+    return records_[(first + index) % RECORD_NUM];
+}
+
+void Input::OnPresent()
+{
+    if (pending_input_time_)
+    {
+        input_latency_      = Time::NowMicroseconds() - pending_input_time_;
+        pending_input_time_ = 0;
+    }
+    else
+    {
+        input_latency_ = 0;
+    }
+}
+
+void Input::AddRecord(Event* evt, InputRecord& record)
+{
+    record.type      = evt->GetType();
+    record.timestamp = evt->GetTimestamp();
+    if (!record.timestamp)
+    {
+        record.timestamp = Time::NowMicroseconds();
+    }
+
+    if (!oldest_input_time_ || record.timestamp < oldest_input_time_)
+    {
+        oldest_input_time_ = record.timestamp;
+    }
+
+    records_[record_end_ % RECORD_NUM] = record;
+    ++record_end_;
 }
 
 bool Input::IsDown(KeyCode key) const
@@ -134,29 +187,52 @@ void Input::HandleEvent(Event* evt)
 {
     if (evt->IsType<MouseEvent>())
     {
+        InputRecord record;
+        record.pos = evt->SafeCast<MouseEvent>()->pos;
+
         if (evt->IsType<MouseMoveEvent>())
         {
-            UpdateMousePos(dynamic_cast<MouseMoveEvent*>(evt)->pos);
+            UpdateMousePos(record.pos);
         }
         else if (evt->IsType<MouseDownEvent>())
         {
-            UpdateButton(dynamic_cast<MouseDownEvent*>(evt)->button, true);
+            record.button = evt->SafeCast<MouseDownEvent>()->button;
+            UpdateButton(record.button, true);
         }
         else if (evt->IsType<MouseUpEvent>())
         {
-            UpdateButton(dynamic_cast<MouseUpEvent*>(evt)->button, false);
+            record.button = evt->SafeCast<MouseUpEvent>()->button;
+            UpdateButton(record.button, false);
+        }
+        else if (evt->IsType<MouseWheelEvent>())
+        {
+            record.wheel = evt->SafeCast<MouseWheelEvent>()->wheel;
         }
+        else
+        {
+            // Hover, out and click events are generated by actors
+            return;
+        }
+        AddRecord(evt, record);
     }
     else if (evt->IsType<KeyEvent>())
     {
+        InputRecord record;
         if (evt->IsType<KeyDownEvent>())
         {
-            UpdateKey(dynamic_cast<KeyDownEvent*>(evt)->code, true);
+            record.key = evt->SafeCast<KeyDownEvent>()->code;
+            UpdateKey(record.key, true);
         }
         else if (evt->IsType<KeyUpEvent>())
         {
-            UpdateKey(dynamic_cast<KeyUpEvent*>(evt)->code, false);
+            record.key = evt->SafeCast<KeyUpEvent>()->code;
+            UpdateKey(record.key, false);
+        }
+        else
+        {
+            return;
         }
+        AddRecord(evt, record);
     }
 }
 }  // namespace kiwano
@@ -28,6 +28,22 @@
 
 namespace kiwano
 {
+/**
+ * \~chinese
+ * @brief 原始输入记录
+ */
+struct InputRecord
+{
+    int64_t     timestamp;  ///< 输入时间戳（微秒）
+    EventType   type;       ///< 输入事件类型
+    KeyCode     key;        ///< 键盘键值
+    MouseButton button;     ///< 鼠标键值
+    Point       pos;        ///< 鼠标位置
+    float       wheel;      ///< 鼠标滚轮值
+
+    InputRecord();
+};
+
 /**
  * \~chinese
  * @brief 输入设备实例，可获取鼠标和键盘的按键状态
@@ -102,6 +118,35 @@ public:
      */
     Point GetMousePos() const;
 
+    /**
+     * \~chinese
+     * @brief 获取当前帧的原始输入记录数量
+     * @details 记录保存在环形缓冲区中，一帧内超过缓冲区容量的较早记录会被覆盖
+     */
+    size_t GetInputRecordCount() const;
+
+    /**
+     * \~chinese
+     * @brief 获取当前帧的原始输入记录
+     * @param index 记录索引，按输入时间先后排列
+     */
+    InputRecord const& GetInputRecord(size_t index) const;
+
+    /**
+     * \~chinese
+     * @brief 获取上一帧的输入延迟
+     * @details 上一帧处理的最早的输入从产生到画面提交（Renderer::Present）所经过的时间，单位为微秒。
+     *          若上一帧没有处理任何输入，返回 0
+     */
+    int64_t GetInputLatency() const;
+
+    /**
+     * \~chinese
+     * @brief 记录画面提交
+     * @details 由 Application 在 Renderer::Present 之后调用
+     */
+    void OnPresent();
+
 public:
     void SetupComponent() override {}
 
@@ -122,13 +167,23 @@ private:
 
     void UpdateMousePos(const Point& pos);
 
+    void AddRecord(Event* evt, InputRecord& record);
+
 private:
     static const int KEY_NUM    = int(KeyCode::Last);
     static const int BUTTON_NUM = int(MouseButton::Last);
+    static const int RECORD_NUM = 256;
 
-    bool  want_update_keys_;
-    bool  want_update_buttons_;
-    Point mouse_pos_;
+    bool    want_update_keys_;
+    bool    want_update_buttons_;
+    Point   mouse_pos_;
+    size_t  record_begin_;
+    size_t  record_end_;
+    int64_t oldest_input_time_;
+    int64_t pending_input_time_;
+    int64_t input_latency_;
+
+    std::array<InputRecord, RECORD_NUM> records_;
 
     enum KeyIndex : size_t
     {
@@ -139,4 +194,22 @@ private:
     std::array<bool, BUTTON_NUM> buttons_[2];
     std::array<bool, KEY_NUM>    keys_[2];
 };
+
+inline InputRecord::InputRecord()
+    : timestamp(0)
+    , key(KeyCode::Unknown)
+    , button(MouseButton::Last)
+    , wheel(0.0f)
+{
+}
+
+inline size_t Input::GetInputRecordCount() const
+{
+    return std::min(record_end_ - record_begin_, size_t(RECORD_NUM));
+}
+
+inline int64_t Input::GetInputLatency() const
+{
+    return input_latency_;
+}
 }  // namespace kiwano
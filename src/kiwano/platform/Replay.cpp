@@ -0,0 +1,432 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <kiwano/core/Logger.h>
+#include <kiwano/core/event/KeyEvent.h>
+#include <kiwano/core/event/MouseEvent.h>
+#include <kiwano/core/event/WindowEvent.h>
+#include <kiwano/platform/FileSystem.h>
+#include <kiwano/platform/Replay.h>
+
+namespace kiwano
+{
+namespace
+{
+
+const char     replay_file_magic[4] = { 'K', 'G', 'R', 'P' };
+const uint32_t replay_file_version  = 1;
+
+#pragma pack(push, 4)
+
+struct ReplayFileHeader
+{
+    char     magic[4];
+    uint32_t version;
+    uint32_t record_size;
+};
+
+#pragma pack(pop)
+
+bool ToRecord(Event* evt, ReplayRecord& record)
+{
+    using Kind = ReplayRecord::Kind;
+
+    if (evt->IsType<MouseEvent>())
+    {
+        auto mouse_evt = evt->SafeCast<MouseEvent>();
+        record.x       = mouse_evt->pos.x;
+        record.y       = mouse_evt->pos.y;
+
+        if (evt->IsType<MouseMoveEvent>())
+        {
+            record.kind = Kind::MouseMove;
+        }
+        else if (evt->IsType<MouseDownEvent>())
+        {
+            record.kind = Kind::MouseDown;
+            record.code = uint32_t(evt->SafeCast<MouseDownEvent>()->button);
+        }
+        else if (evt->IsType<MouseUpEvent>())
+        {
+            record.kind = Kind::MouseUp;
+            record.code = uint32_t(evt->SafeCast<MouseUpEvent>()->button);
+        }
+        else if (evt->IsType<MouseWheelEvent>())
+        {
+            record.kind = Kind::MouseWheel;
+            record.z    = evt->SafeCast<MouseWheelEvent>()->wheel;
+        }
+        else
+        {
+            // Hover, out and click events are generated by actors
+            return false;
+        }
+        return true;
+    }
+
+    if (evt->IsType<KeyDownEvent>())
+    {
+        record.kind = Kind::KeyDown;
+        record.code = uint32_t(evt->SafeCast<KeyDownEvent>()->code);
+        return true;
+    }
+
+    if (evt->IsType<KeyUpEvent>())
+    {
+        record.kind = Kind::KeyUp;
+        record.code = uint32_t(evt->SafeCast<KeyUpEvent>()->code);
+        return true;
+    }
+
+    if (evt->IsType<KeyCharEvent>())
+    {
+        record.kind = Kind::KeyChar;
+        record.code = uint32_t(uint8_t(evt->SafeCast<KeyCharEvent>()->value));
+        return true;
+    }
+
+    if (evt->IsType<WindowMovedEvent>())
+    {
+        auto window_evt = evt->SafeCast<WindowMovedEvent>();
+        record.kind     = Kind::WindowMoved;
+        record.x        = float(window_evt->x);
+        record.y        = float(window_evt->y);
+        return true;
+    }
+
+    if (evt->IsType<WindowResizedEvent>())
+    {
+        auto window_evt = evt->SafeCast<WindowResizedEvent>();
+        record.kind     = Kind::WindowResized;
+        record.x        = float(window_evt->width);
+        record.y        = float(window_evt->height);
+        return true;
+    }
+
+    if (evt->IsType<WindowFocusChangedEvent>())
+    {
+        record.kind = Kind::WindowFocusChanged;
+        record.code = evt->SafeCast<WindowFocusChangedEvent>()->focus ? 1 : 0;
+        return true;
+    }
+
+    if (evt->IsType<WindowClosedEvent>())
+    {
+        record.kind = Kind::WindowClosed;
+        return true;
+    }
+
+    // Title changes are caused by the application itself and will happen again during replay
+    return false;
+}
+
+EventPtr ToEvent(ReplayRecord const& record)
+{
+    using Kind = ReplayRecord::Kind;
+
+    switch (record.kind)
+    {
+    case Kind::MouseMove:
+    {
+        MouseMoveEventPtr evt = new MouseMoveEvent;
+        evt->pos              = Point(record.x, record.y);
+        return evt;
+    }
+    case Kind::MouseDown:
+    {
+        MouseDownEventPtr evt = new MouseDownEvent;
+        evt->pos              = Point(record.x, record.y);
+        evt->button           = MouseButton(record.code);
+        return evt;
+    }
+    case Kind::MouseUp:
+    {
+        MouseUpEventPtr evt = new MouseUpEvent;
+        evt->pos            = Point(record.x, record.y);
+        evt->button         = MouseButton(record.code);
+        return evt;
+    }
+    case Kind::MouseWheel:
+    {
+        MouseWheelEventPtr evt = new MouseWheelEvent;
+        evt->pos               = Point(record.x, record.y);
+        evt->wheel             = record.z;
+        return evt;
+    }
+    case Kind::KeyDown:
+    {
+        KeyDownEventPtr evt = new KeyDownEvent;
+        evt->code           = KeyCode(record.code);
+        return evt;
+    }
+    case Kind::KeyUp:
+    {
+        KeyUpEventPtr evt = new KeyUpEvent;
+        evt->code         = KeyCode(record.code);
+        return evt;
+    }
+    case Kind::KeyChar:
+    {
+        KeyCharEventPtr evt = new KeyCharEvent;
+        evt->value          = char(record.code);
+        return evt;
+    }
+    case Kind::WindowMoved:
+    {
+        WindowMovedEventPtr evt = new WindowMovedEvent;
+        evt->x                  = int(record.x);
+        evt->y                  = int(record.y);
+        return evt;
+    }
+    case Kind::WindowResized:
+    {
+        WindowResizedEventPtr evt = new WindowResizedEvent;
+        evt->width                = uint32_t(record.x);
+        evt->height               = uint32_t(record.y);
+        return evt;
+    }
+    case Kind::WindowFocusChanged:
+    {
+        WindowFocusChangedEventPtr evt = new WindowFocusChangedEvent;
+        evt->focus                     = record.code != 0;
+        return evt;
+    }
+    case Kind::WindowClosed:
+    {
+        WindowClosedEventPtr evt = new WindowClosedEvent;
+        return evt;
+    }
+    default:
+        break;
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+//-------------------------------------------------------
+// ReplayRecorder
+//-------------------------------------------------------
+
+ReplayRecorderPtr ReplayRecorder::Create(String const& file_path)
+{
+    ReplayRecorderPtr ptr = new (std::nothrow) ReplayRecorder;
+    if (ptr)
+    {
+        if (!ptr->Open(file_path))
+            return nullptr;
+    }
+    return ptr;
+}
+
+ReplayRecorder::ReplayRecorder()
+    : frame_count_(0)
+    , event_count_(0)
+{
+}
+
+ReplayRecorder::~ReplayRecorder()
+{
+    Close();
+}
+
+bool ReplayRecorder::Open(String const& file_path)
+{
+    Close();
+
+    ofs_.open(file_path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!ofs_)
+    {
+        KGE_ERROR(L"ReplayRecorder::Open failed: Cannot open file %s", file_path.c_str());
+        return false;
+    }
+
+    ReplayFileHeader header;
+    ::memcpy(header.magic, replay_file_magic, sizeof(header.magic));
+    header.version     = replay_file_version;
+    header.record_size = uint32_t(sizeof(ReplayRecord));
+    ofs_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    frame_count_ = 0;
+    event_count_ = 0;
+    return ofs_.good();
+}
+
+void ReplayRecorder::Close()
+{
+    if (ofs_.is_open())
+    {
+        ofs_.close();
+    }
+}
+
+void ReplayRecorder::RecordEvent(Event* evt)
+{
+    if (!evt || !ofs_.is_open())
+        return;
+
+    ReplayRecord record;
+    if (ToRecord(evt, record))
+    {
+        Write(record);
+        ++event_count_;
+    }
+}
+
+void ReplayRecorder::RecordFrame(Duration dt)
+{
+    if (!ofs_.is_open())
+        return;
+
+    ReplayRecord record;
+    record.kind = ReplayRecord::Kind::Frame;
+    record.code = uint32_t(std::max(dt.Milliseconds(), 0L));
+    Write(record);
+    ++frame_count_;
+}
+
+void ReplayRecorder::Write(ReplayRecord const& record)
+{
+    ofs_.write(reinterpret_cast<const char*>(&record), sizeof(record));
+}
+
+//-------------------------------------------------------
+// ReplayPlayer
+//-------------------------------------------------------
+
+ReplayPlayerPtr ReplayPlayer::Create(String const& file_path)
+{
+    ReplayPlayerPtr ptr = new (std::nothrow) ReplayPlayer;
+    if (ptr)
+    {
+        if (!ptr->Load(file_path))
+            return nullptr;
+    }
+    return ptr;
+}
+
+ReplayPlayer::ReplayPlayer()
+    : frame_count_(0)
+    , cursor_(0)
+{
+}
+
+ReplayPlayer::~ReplayPlayer() {}
+
+bool ReplayPlayer::Load(String const& file_path)
+{
+    String full_path = FileSystem::Instance().GetFullPathForFile(file_path);
+    if (full_path.empty())
+    {
+        KGE_ERROR(L"ReplayPlayer::Load failed: File not found.");
+        return false;
+    }
+
+    std::ifstream ifs(full_path.c_str(), std::ios::binary);
+    if (!ifs)
+    {
+        KGE_ERROR(L"ReplayPlayer::Load failed: Cannot open file %s", full_path.c_str());
+        return false;
+    }
+
+    ReplayFileHeader header;
+    if (!ifs.read(reinterpret_cast<char*>(&header), sizeof(header))
+        || ::memcmp(header.magic, replay_file_magic, sizeof(header.magic)) != 0)
+    {
+        KGE_ERROR(L"ReplayPlayer::Load failed: Invalid replay file");
+        return false;
+    }
+
+    if (header.version != replay_file_version || header.record_size != sizeof(ReplayRecord))
+    {
+        KGE_ERROR(L"ReplayPlayer::Load failed: Unsupported replay file version %u", header.version);
+        return false;
+    }
+
+    records_.clear();
+    frame_count_ = 0;
+
+    // A truncated tail (e.g. the recording application crashed) is ignored
+    ReplayRecord record;
+    while (ifs.read(reinterpret_cast<char*>(&record), sizeof(record)))
+    {
+        records_.push_back(record);
+        if (record.kind == ReplayRecord::Kind::Frame)
+            ++frame_count_;
+    }
+
+    Rewind();
+    return true;
+}
+
+bool ReplayPlayer::NextFrame(Vector<EventPtr>& events, Duration& dt)
+{
+    events.clear();
+    while (cursor_ < records_.size())
+    {
+        const auto& record = records_[cursor_++];
+        if (record.kind == ReplayRecord::Kind::Frame)
+        {
+            dt = Duration(long(record.code));
+            frame_dts_.push_back(dt);
+            return true;
+        }
+
+        if (EventPtr evt = ToEvent(record))
+        {
+            events.push_back(evt);
+        }
+    }
+    // Events after the last frame are not replayed
+    return false;
+}
+
+void ReplayPlayer::Rewind()
+{
+    cursor_ = 0;
+    frame_dts_.clear();
+    frame_costs_.clear();
+}
+
+int64_t ReplayPlayer::GetFrameCost(uint32_t index) const
+{
+    KGE_ASSERT(index < frame_costs_.size());
+    return frame_costs_[index];
+}
+
+bool ReplayPlayer::SaveFrameCosts(String const& file_path) const
+{
+    std::ofstream ofs(file_path.c_str(), std::ios::trunc);
+    if (!ofs)
+    {
+        KGE_ERROR(L"ReplayPlayer::SaveFrameCosts failed: Cannot open file %s", file_path.c_str());
+        return false;
+    }
+
+    ofs << "frame,dt_ms,cost_us\n";
+    for (size_t i = 0; i < frame_costs_.size(); ++i)
+    {
+        ofs << i << ',' << frame_dts_[i].Milliseconds() << ',' << frame_costs_[i] << '\n';
+    }
+    return ofs.good();
+}
+
+}  // namespace kiwano
@@ -0,0 +1,232 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+#include <kiwano/core/ObjectBase.h>
+#include <kiwano/core/Time.h>
+#include <kiwano/core/event/Event.h>
+#include <fstream>
+
+namespace kiwano
+{
+KGE_DECLARE_SMART_PTR(ReplayRecorder);
+KGE_DECLARE_SMART_PTR(ReplayPlayer);
+
+/**
+ * \~chinese
+ * @brief 回放记录
+ * @details 回放文件由文件头和一系列定长记录组成，每帧的事件记录之后是该帧的帧记录
+ */
+struct ReplayRecord
+{
+    /**
+     * \~chinese
+     * @brief 记录类型
+     */
+    enum class Kind : uint32_t
+    {
+        Frame = 0,           ///< 帧，code 为帧间隔（毫秒）
+        MouseMove,           ///< 鼠标移动，x y 为鼠标位置
+        MouseDown,           ///< 鼠标按下，code 为鼠标键值
+        MouseUp,             ///< 鼠标抬起，code 为鼠标键值
+        MouseWheel,          ///< 鼠标滚轮，z 为滚轮值
+        KeyDown,             ///< 键盘按下，code 为键值
+        KeyUp,               ///< 键盘抬起，code 为键值
+        KeyChar,             ///< 输出字符，code 为字符
+        WindowMoved,         ///< 窗口移动，x y 为窗口位置
+        WindowResized,       ///< 窗口大小变化，x y 为窗口大小
+        WindowFocusChanged,  ///< 窗口焦点变化，code 为是否获得焦点
+        WindowClosed,        ///< 窗口关闭
+    };
+
+    Kind     kind;
+    uint32_t code;
+    float    x;
+    float    y;
+    float    z;
+
+    ReplayRecord();
+};
+
+/**
+ * \~chinese
+ * @brief 回放录制器
+ * @details 录制应用程序分发的所有窗口事件和每帧的帧间隔，并写入二进制回放文件，
+ *          回放文件可由 ReplayPlayer 读取并通过 Application::Replay 重现同一次运行过程
+ * @see Application::SetRecorder
+ */
+class KGE_API ReplayRecorder : public virtual ObjectBase
+{
+public:
+    /// \~chinese
+    /// @brief 创建回放录制器
+    /// @param file_path 回放文件路径
+    static ReplayRecorderPtr Create(String const& file_path);
+
+    ReplayRecorder();
+
+    virtual ~ReplayRecorder();
+
+    /// \~chinese
+    /// @brief 打开回放文件
+    /// @param file_path 回放文件路径
+    bool Open(String const& file_path);
+
+    /// \~chinese
+    /// @brief 关闭回放文件
+    void Close();
+
+    /// \~chinese
+    /// @brief 是否正在录制
+    bool IsRecording() const;
+
+    /// \~chinese
+    /// @brief 录制事件
+    /// @details 无法录制的事件类型（如自定义事件）将被忽略
+    void RecordEvent(Event* evt);
+
+    /// \~chinese
+    /// @brief 录制帧
+    /// @param dt 帧间隔
+    void RecordFrame(Duration dt);
+
+    /// \~chinese
+    /// @brief 获取已录制的帧数
+    uint32_t GetFrameCount() const;
+
+    /// \~chinese
+    /// @brief 获取已录制的事件数量
+    uint32_t GetEventCount() const;
+
+private:
+    void Write(ReplayRecord const& record);
+
+private:
+    uint32_t      frame_count_;
+    uint32_t      event_count_;
+    std::ofstream ofs_;
+};
+
+/**
+ * \~chinese
+ * @brief 回放播放器
+ * @details 读取回放文件，按帧还原录制的事件和帧间隔，并统计回放时每帧的耗时
+ * @see Application::Replay
+ */
+class KGE_API ReplayPlayer : public virtual ObjectBase
+{
+    friend class Application;
+
+public:
+    /// \~chinese
+    /// @brief 创建回放播放器
+    /// @param file_path 回放文件路径
+    static ReplayPlayerPtr Create(String const& file_path);
+
+    ReplayPlayer();
+
+    virtual ~ReplayPlayer();
+
+    /// \~chinese
+    /// @brief 加载回放文件
+    /// @param file_path 回放文件路径
+    bool Load(String const& file_path);
+
+    /// \~chinese
+    /// @brief 读取下一帧
+    /// @param[out] events 该帧需要分发的事件
+    /// @param[out] dt 该帧的帧间隔
+    /// @return 回放已结束时返回 false
+    bool NextFrame(Vector<EventPtr>& events, Duration& dt);
+
+    /// \~chinese
+    /// @brief 回到回放开头
+    void Rewind();
+
+    /// \~chinese
+    /// @brief 获取回放文件中的帧数
+    uint32_t GetFrameCount() const;
+
+    /// \~chinese
+    /// @brief 获取已回放的帧数
+    uint32_t GetPlayedFrameCount() const;
+
+    /// \~chinese
+    /// @brief 获取回放时某一帧的耗时（微秒）
+    /// @param index 帧序号
+    int64_t GetFrameCost(uint32_t index) const;
+
+    /// \~chinese
+    /// @brief 将回放时每帧的帧间隔和耗时保存为 CSV 文件
+    /// @param file_path 文件路径
+    bool SaveFrameCosts(String const& file_path) const;
+
+private:
+    void AddFrameCost(int64_t cost);
+
+private:
+    uint32_t             frame_count_;
+    size_t               cursor_;
+    Vector<ReplayRecord> records_;
+    Vector<Duration>     frame_dts_;
+    Vector<int64_t>      frame_costs_;
+};
+
+inline ReplayRecord::ReplayRecord()
+    : kind(Kind::Frame)
+    , code(0)
+    , x(0)
+    , y(0)
+    , z(0)
+{
+}
+
+inline bool ReplayRecorder::IsRecording() const
+{
+    return ofs_.is_open();
+}
+
+inline uint32_t ReplayRecorder::GetFrameCount() const
+{
+    return frame_count_;
+}
+
+inline uint32_t ReplayRecorder::GetEventCount() const
+{
+    return event_count_;
+}
+
+inline uint32_t ReplayPlayer::GetFrameCount() const
+{
+    return frame_count_;
+}
+
+inline uint32_t ReplayPlayer::GetPlayedFrameCount() const
+{
+    return uint32_t(frame_costs_.size());
+}
+
+inline void ReplayPlayer::AddFrameCost(int64_t cost)
+{
+    frame_costs_.push_back(cost);
+}
+
+}  // namespace kiwano
@@ -19,12 +19,16 @@
 // THE SOFTWARE.
 
 #include <kiwano/platform/Window.h>
+#include <kiwano/core/Time.h>
+#include <kiwano/core/event/MouseEvent.h>
 
 namespace kiwano
 {
 
 Window::Window()
     : should_close_(false)
+    , minimized_(false)
+    , coalescing_enabled_(false)
     , width_(0)
     , height_(0)
 {
@@ -41,6 +45,12 @@ EventPtr Window::PollEvent()
     {
         evt = event_queue_.front();
         event_queue_.pop();
+        ++event_status_.dispatched;
+    }
+    else
+    {
+        last_event_status_ = event_status_;
+        event_status_      = EventStatus();
     }
     return evt;
 }
@@ -72,6 +82,37 @@ bool Window::ShouldClose()
 
 void Window::PushEvent(EventPtr evt)
 {
+    ++event_status_.received;
+
+    if (evt->GetTimestamp() == 0)
+    {
+        evt->SetTimestamp(Time::NowMicroseconds());
+    }
+
+    if (coalescing_enabled_ && !event_queue_.empty())
+    {
+        Event* last = event_queue_.back().get();
+        if (last->GetType() == evt->GetType())
+        {
+            if (evt->IsType<MouseMoveEvent>())
+            {
+                last->SafeCast<MouseMoveEvent>()->pos = evt->SafeCast<MouseMoveEvent>()->pos;
+                ++event_status_.coalesced;
+                return;
+            }
+
+            if (evt->IsType<MouseWheelEvent>())
+            {
+                auto last_wheel = last->SafeCast<MouseWheelEvent>();
+                auto wheel_evt  = evt->SafeCast<MouseWheelEvent>();
+                last_wheel->pos = wheel_evt->pos;
+                last_wheel->wheel += wheel_evt->wheel;
+                ++event_status_.coalesced;
+                return;
+            }
+        }
+    }
+
     event_queue_.push(evt);
 }
 
@@ -61,6 +61,19 @@ typedef HWND WindowHandle;
 class KGE_API Window : protected Noncopyable
 {
 public:
+    /**
+     * \~chinese
+     * @brief 窗口事件队列状态
+     */
+    struct EventStatus
+    {
+        uint32_t received;    ///< 放入队列的事件数量
+        uint32_t coalesced;   ///< 被合并的事件数量
+        uint32_t dispatched;  ///< 从队列中取出的事件数量
+
+        EventStatus();
+    };
+
     /**
      * \~chinese
      * @brief 获取窗口实例
@@ -109,6 +122,12 @@ public:
      */
     uint32_t GetHeight() const;
 
+    /**
+     * \~chinese
+     * @brief 窗口是否被最小化
+     */
+    bool IsMinimized() const;
+
     /**
      * \~chinese
      * @brief 获取窗口句柄
@@ -164,10 +183,33 @@ public:
     /**
      * \~chinese
      * @brief 将窗口事件放入队列
+     * @details 未设置时间戳的事件会以当前时间作为时间戳
      * @param evt 窗口事件
      */
     void PushEvent(EventPtr evt);
 
+    /**
+     * \~chinese
+     * @brief 启用或禁用事件合并
+     * @details 启用后，连续的鼠标移动事件只保留最新的鼠标位置，连续的鼠标滚轮事件累加滚轮值，
+     *          以减少每帧需要分发的事件数量。合并后的事件保留最早的时间戳。默认不启用
+     * @param enabled 是否启用
+     */
+    void SetEventCoalescingEnabled(bool enabled);
+
+    /**
+     * \~chinese
+     * @brief 是否启用了事件合并
+     */
+    bool IsEventCoalescingEnabled() const;
+
+    /**
+     * \~chinese
+     * @brief 获取上一帧的事件队列状态
+     * @details 每次事件队列被取空时视为一帧结束
+     */
+    EventStatus const& GetEventStatus() const;
+
     /**
      * \~chinese
      * @brief 窗口是否需要关闭
@@ -189,10 +231,41 @@ protected:
 
 protected:
     bool                 should_close_;
+    bool                 minimized_;
+    bool                 coalescing_enabled_;
     uint32_t             width_;
     uint32_t             height_;
     String               title_;
     std::queue<EventPtr> event_queue_;
+    EventStatus          event_status_;
+    EventStatus          last_event_status_;
 };
 
+inline Window::EventStatus::EventStatus()
+    : received(0)
+    , coalesced(0)
+    , dispatched(0)
+{
+}
+
+inline bool Window::IsMinimized() const
+{
+    return minimized_;
+}
+
+inline void Window::SetEventCoalescingEnabled(bool enabled)
+{
+    coalescing_enabled_ = enabled;
+}
+
+inline bool Window::IsEventCoalescingEnabled() const
+{
+    return coalescing_enabled_;
+}
+
+inline Window::EventStatus const& Window::GetEventStatus() const
+{
+    return last_event_status_;
+}
+
 }  // namespace kiwano
@@ -586,11 +586,15 @@ LRESULT CALLBACK WindowImpl::WndProc(HWND hwnd, UINT32 msg, WPARAM wparam, LPARA
         if (SIZE_MAXHIDE == wparam || SIZE_MINIMIZED == wparam)
         {
             KGE_SYS_LOG(L"Window minimized");
+
+            window->minimized_ = true;
         }
         else
         {
             // KGE_SYS_LOG(L"Window resized");
 
+            window->minimized_ = false;
+
             window->width_ = ((uint32_t)(short)LOWORD(lparam));
             window->height_ = ((uint32_t)(short)HIWORD(lparam));
 
@@ -96,6 +96,20 @@ bool Brush::IsValid() const
     return raw_ != nullptr;
 }
 
+bool Brush::IsOpaque() const
+{
+    if (type_ == Type::SolidColor && raw_)
+    {
+        ComPtr<ID2D1SolidColorBrush> solid_brush;
+
+        if (SUCCEEDED(raw_->QueryInterface(&solid_brush)))
+        {
+            return solid_brush->GetColor().a >= 1.f && raw_->GetOpacity() >= 1.f;
+        }
+    }
+    return false;
+}
+
 float Brush::GetOpacity() const
 {
     return opacity_;
@@ -141,6 +141,10 @@ public:
     /// @brief 获取画刷类型
     Type GetType() const;
 
+    /// \~chinese
+    /// @brief 是否为完全不透明的纯色画刷
+    bool IsOpaque() const;
+
 private:
     /// \~chinese
     /// @brief 获取透明度
@@ -0,0 +1,164 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <kiwano/render/DamageRegion.h>
+
+namespace kiwano
+{
+namespace
+{
+
+inline float GetArea(Rect const& rect)
+{
+    return rect.GetWidth() * rect.GetHeight();
+}
+
+inline Rect GetUnion(Rect const& a, Rect const& b)
+{
+    return Rect{ std::min(a.left_top.x, b.left_top.x), std::min(a.left_top.y, b.left_top.y),
+                 std::max(a.right_bottom.x, b.right_bottom.x), std::max(a.right_bottom.y, b.right_bottom.y) };
+}
+
+inline bool IsOverlapped(Rect const& a, Rect const& b)
+{
+    return a.left_top.x < b.right_bottom.x && b.left_top.x < a.right_bottom.x && a.left_top.y < b.right_bottom.y
+           && b.left_top.y < a.right_bottom.y;
+}
+
+}  // namespace
+
+DamageRegion::DamageRegion(size_t max_rects)
+    : full_(false)
+    , max_rects_(std::max(max_rects, size_t(1)))
+    , full_ratio_(0.5f)
+{
+}
+
+void DamageRegion::SetBounds(Rect const& bounds)
+{
+    if (bounds_ == bounds)
+        return;
+
+    bounds_ = bounds;
+    if (!rects_.empty())
+    {
+        Invalidate();
+    }
+}
+
+void DamageRegion::Add(Rect const& rect)
+{
+    if (full_)
+        return;
+
+    // clip to bounds and snap to pixels, so that anti-aliased edges are covered
+    Rect damage{ std::floor(std::max(rect.left_top.x, bounds_.left_top.x)),
+                 std::floor(std::max(rect.left_top.y, bounds_.left_top.y)),
+                 std::ceil(std::min(rect.right_bottom.x, bounds_.right_bottom.x)),
+                 std::ceil(std::min(rect.right_bottom.y, bounds_.right_bottom.y)) };
+
+    if (damage.GetWidth() <= 0.f || damage.GetHeight() <= 0.f)
+        return;
+
+    // absorb all overlapped rects, keep them disjoint
+    for (size_t i = 0; i < rects_.size();)
+    {
+        if (IsOverlapped(rects_[i], damage))
+        {
+            damage = GetUnion(rects_[i], damage);
+            rects_.erase(rects_.begin() + i);
+            i = 0;
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    rects_.push_back(damage);
+
+    while (rects_.size() > max_rects_)
+    {
+        MergeClosestRects();
+    }
+
+    CheckFullRedraw();
+}
+
+void DamageRegion::Invalidate()
+{
+    full_ = true;
+    rects_.clear();
+    rects_.push_back(bounds_);
+}
+
+void DamageRegion::Clear()
+{
+    full_ = false;
+    rects_.clear();
+}
+
+void DamageRegion::MergeClosestRects()
+{
+    // merge the pair that wastes the least area
+    size_t merge_a = 0, merge_b = 1;
+    float  min_waste = math::FLOAT_MAX;
+
+    for (size_t i = 0; i < rects_.size(); ++i)
+    {
+        for (size_t j = i + 1; j < rects_.size(); ++j)
+        {
+            float waste = GetArea(GetUnion(rects_[i], rects_[j])) - GetArea(rects_[i]) - GetArea(rects_[j]);
+            if (waste < min_waste)
+            {
+                min_waste = waste;
+                merge_a   = i;
+                merge_b   = j;
+            }
+        }
+    }
+
+    Rect merged = GetUnion(rects_[merge_a], rects_[merge_b]);
+    rects_.erase(rects_.begin() + merge_b);
+    rects_.erase(rects_.begin() + merge_a);
+
+    // the merged rect may overlap others now
+    Add(merged);
+}
+
+void DamageRegion::CheckFullRedraw()
+{
+    if (full_)
+        return;
+
+    float damage_area = 0.f;
+    for (const auto& rect : rects_)
+    {
+        damage_area += GetArea(rect);
+    }
+
+    if (damage_area >= GetArea(bounds_) * full_ratio_)
+    {
+        Invalidate();
+    }
+}
+
+}  // namespace kiwano
@@ -0,0 +1,122 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+#include <kiwano/core/Common.h>
+#include <kiwano/math/Math.h>
+
+namespace kiwano
+{
+
+/**
+ * \addtogroup Render
+ * @{
+ */
+
+/**
+ * \~chinese
+ * @brief 脏区域
+ * @details 收集需要重绘的屏幕区域，并将其合并为少量互不相交的矩形，重绘面积过大时退化为全屏重绘
+ */
+class KGE_API DamageRegion
+{
+public:
+    /// \~chinese
+    /// @brief 构建脏区域
+    /// @param max_rects 最多保留的矩形数量
+    DamageRegion(size_t max_rects = 4);
+
+    /// \~chinese
+    /// @brief 获取脏区域的边界（即视区）
+    Rect const& GetBounds() const;
+
+    /// \~chinese
+    /// @brief 设置脏区域的边界，添加的矩形将被裁剪到边界内
+    void SetBounds(Rect const& bounds);
+
+    /// \~chinese
+    /// @brief 设置触发全屏重绘的面积比例，默认为 0.5
+    void SetFullRedrawThreshold(float ratio);
+
+    /// \~chinese
+    /// @brief 添加需要重绘的矩形
+    void Add(Rect const& rect);
+
+    /// \~chinese
+    /// @brief 标记整个区域需要重绘
+    void Invalidate();
+
+    /// \~chinese
+    /// @brief 清空脏区域
+    void Clear();
+
+    /// \~chinese
+    /// @brief 是否没有需要重绘的区域
+    bool IsEmpty() const;
+
+    /// \~chinese
+    /// @brief 是否需要全屏重绘
+    bool IsFull() const;
+
+    /// \~chinese
+    /// @brief 获取需要重绘的矩形，全屏重绘时仅包含边界矩形
+    Vector<Rect> const& GetRects() const;
+
+private:
+    void MergeClosestRects();
+
+    void CheckFullRedraw();
+
+private:
+    bool         full_;
+    size_t       max_rects_;
+    float        full_ratio_;
+    Rect         bounds_;
+    Vector<Rect> rects_;
+};
+
+/** @} */
+
+inline Rect const& DamageRegion::GetBounds() const
+{
+    return bounds_;
+}
+
+inline void DamageRegion::SetFullRedrawThreshold(float ratio)
+{
+    full_ratio_ = ratio;
+}
+
+inline bool DamageRegion::IsEmpty() const
+{
+    return rects_.empty();
+}
+
+inline bool DamageRegion::IsFull() const
+{
+    return full_;
+}
+
+inline Vector<Rect> const& DamageRegion::GetRects() const
+{
+    return rects_;
+}
+}  // namespace kiwano
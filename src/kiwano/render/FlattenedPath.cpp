@@ -0,0 +1,189 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <algorithm>
+#include <kiwano/core/Logger.h>
+#include <kiwano/render/FlattenedPath.h>
+#include <kiwano/render/Shape.h>
+
+namespace kiwano
+{
+namespace
+{
+
+// Receives the line segments of a simplified geometry
+class FlattenedPathSink : public ID2D1SimplifiedGeometrySink
+{
+public:
+    FlattenedPathSink(Vector<Point>& points, Vector<float>& lengths)
+        : points_(points)
+        , lengths_(lengths)
+        , length_(0.f)
+    {
+    }
+
+    STDMETHOD_(void, SetFillMode)(D2D1_FILL_MODE) {}
+
+    STDMETHOD_(void, SetSegmentFlags)(D2D1_PATH_SEGMENT) {}
+
+    STDMETHOD_(void, BeginFigure)(D2D1_POINT_2F start, D2D1_FIGURE_BEGIN)
+    {
+        // Figures are joined by zero-length segments, which are never picked by a length query
+        figure_start_ = Point(start.x, start.y);
+        points_.push_back(figure_start_);
+        lengths_.push_back(length_);
+    }
+
+    STDMETHOD_(void, AddLines)(const D2D1_POINT_2F* points, UINT32 count)
+    {
+        for (UINT32 i = 0; i < count; ++i)
+        {
+            AddPoint(Point(points[i].x, points[i].y));
+        }
+    }
+
+    STDMETHOD_(void, AddBeziers)(const D2D1_BEZIER_SEGMENT*, UINT32)
+    {
+        // Never called when simplified to lines
+    }
+
+    STDMETHOD_(void, EndFigure)(D2D1_FIGURE_END end)
+    {
+        if (end == D2D1_FIGURE_END_CLOSED)
+        {
+            AddPoint(figure_start_);
+        }
+    }
+
+    STDMETHOD(Close)()
+    {
+        return S_OK;
+    }
+
+    STDMETHOD_(unsigned long, AddRef)()
+    {
+        return 1;
+    }
+
+    STDMETHOD_(unsigned long, Release)()
+    {
+        return 1;
+    }
+
+    STDMETHOD(QueryInterface)(IID const& riid, void** object)
+    {
+        if (__uuidof(ID2D1SimplifiedGeometrySink) == riid || __uuidof(IUnknown) == riid)
+        {
+            *object = this;
+            return S_OK;
+        }
+        *object = nullptr;
+        return E_NOINTERFACE;
+    }
+
+private:
+    void AddPoint(Point const& point)
+    {
+        length_ += (point - points_.back()).Length();
+        points_.push_back(point);
+        lengths_.push_back(length_);
+    }
+
+private:
+    Vector<Point>& points_;
+    Vector<float>& lengths_;
+    float          length_;
+    Point          figure_start_;
+};
+
+}  // namespace
+
+FlattenedPathPtr FlattenedPath::Create(Shape const& shape, float tolerance)
+{
+    FlattenedPathPtr ptr = new (std::nothrow) FlattenedPath;
+    if (ptr)
+    {
+        ComPtr<ID2D1Geometry> geo = shape.GetGeometry();
+        if (geo)
+        {
+            FlattenedPathSink sink(ptr->points_, ptr->lengths_);
+
+            HRESULT hr = geo->Simplify(D2D1_GEOMETRY_SIMPLIFICATION_OPTION_LINES, nullptr, tolerance, &sink);
+            if (FAILED(hr))
+            {
+                KGE_ERROR(L"Flatten shape failed with HRESULT of %08X", hr);
+
+                ptr->points_.clear();
+                ptr->lengths_.clear();
+            }
+        }
+    }
+    return ptr;
+}
+
+FlattenedPath::FlattenedPath() {}
+
+bool FlattenedPath::ComputePointAtLength(float length, Point& point, Vec2& tangent) const
+{
+    if (!IsValid())
+        return false;
+
+    const size_t count = lengths_.size();
+
+    // Find the segment [i, i + 1] that contains the length
+    size_t index = 0;
+    if (length >= lengths_[count - 1])
+    {
+        // Use the last segment that has a length
+        index = count - 2;
+        while (index > 0 && lengths_[index + 1] <= lengths_[index])
+            --index;
+    }
+    else if (length > 0.f)
+    {
+        const float* begin = lengths_.begin();
+        index              = size_t(std::upper_bound(begin, begin + count, length) - begin) - 1;
+    }
+    else
+    {
+        while (index + 2 < count && lengths_[index + 1] <= lengths_[index])
+            ++index;
+    }
+
+    const Point& start = points_[index];
+    const Point& end   = points_[index + 1];
+
+    float segment = lengths_[index + 1] - lengths_[index];
+    if (segment <= 0.f)
+    {
+        point   = start;
+        tangent = Vec2(1.f, 0.f);
+        return true;
+    }
+
+    float percent = std::min(std::max((length - lengths_[index]) / segment, 0.f), 1.f);
+
+    point   = start + (end - start) * percent;
+    tangent = (end - start) / segment;
+    return true;
+}
+
+}  // namespace kiwano
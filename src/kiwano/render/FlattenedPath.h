@@ -0,0 +1,86 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+#include <kiwano/core/ObjectBase.h>
+#include <kiwano/math/Math.h>
+
+namespace kiwano
+{
+class Shape;
+
+KGE_DECLARE_SMART_PTR(FlattenedPath);
+
+/**
+ * \addtogroup Render
+ * @{
+ */
+
+/**
+ * \~chinese
+ * @brief 展平路径
+ * @details 将形状展平为折线，并记录每个顶点处的累积弧长。
+ * 查询路径上点的位置和切线只需二分查找和线性插值，不再需要遍历整个几何图形
+ */
+class KGE_API FlattenedPath : public virtual ObjectBase
+{
+public:
+    /// \~chinese
+    /// @brief 展平形状
+    /// @param shape 形状
+    /// @param tolerance 展平的误差容限
+    static FlattenedPathPtr Create(Shape const& shape, float tolerance = 0.25f);
+
+    FlattenedPath();
+
+    /// \~chinese
+    /// @brief 是否有效
+    bool IsValid() const;
+
+    /// \~chinese
+    /// @brief 获取路径长度
+    float GetLength() const;
+
+    /// \~chinese
+    /// @brief 计算路径上点的位置和切线向量
+    /// @param[in] length 点在路径上的位置（弧长）
+    /// @param[out] point 点的位置
+    /// @param[out] tangent 点的单位切线向量
+    bool ComputePointAtLength(float length, Point& point, Vec2& tangent) const;
+
+private:
+    Vector<Point> points_;
+    Vector<float> lengths_;
+};
+
+/** @} */
+
+inline bool FlattenedPath::IsValid() const
+{
+    return points_.size() > 1;
+}
+
+inline float FlattenedPath::GetLength() const
+{
+    return lengths_.empty() ? 0.f : lengths_.back();
+}
+
+}  // namespace kiwano
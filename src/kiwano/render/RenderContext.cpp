@@ -81,8 +81,12 @@ void RenderContext::BeginDraw()
 {
     if (collecting_status_)
     {
-        status_.start      = Time::Now();
-        status_.primitives = 0;
+        status_.start               = Time::Now();
+        status_.primitives          = 0;
+        status_.drawn_actors        = 0;
+        status_.culled_actors       = 0;
+        status_.static_cache_hits   = 0;
+        status_.static_cache_misses = 0;
     }
 
     if (render_target_)
@@ -490,6 +494,50 @@ void RenderContext::IncreasePrimitivesCount(uint32_t increase) const
     }
 }
 
+void RenderContext::IncreaseDrawnActorsCount() const
+{
+    if (collecting_status_)
+    {
+        ++status_.drawn_actors;
+    }
+}
+
+void RenderContext::IncreaseCulledActorsCount() const
+{
+    if (collecting_status_)
+    {
+        ++status_.culled_actors;
+    }
+}
+
+void RenderContext::IncreaseStaticCacheHitsCount() const
+{
+    if (collecting_status_)
+    {
+        ++status_.static_cache_hits;
+    }
+}
+
+void RenderContext::IncreaseStaticCacheMissesCount() const
+{
+    if (collecting_status_)
+    {
+        ++status_.static_cache_misses;
+    }
+}
+
+void RenderContext::MergeStatus(Status const& status) const
+{
+    if (collecting_status_)
+    {
+        status_.primitives += status.primitives;
+        status_.drawn_actors += status.drawn_actors;
+        status_.culled_actors += status.culled_actors;
+        status_.static_cache_hits += status.static_cache_hits;
+        status_.static_cache_misses += status.static_cache_misses;
+    }
+}
+
 void RenderContext::SaveDrawingState()
 {
     KGE_ASSERT(IsValid());
@@ -57,6 +57,8 @@ enum class TextAntialiasMode
 class KGE_API RenderContext : public virtual ObjectBase
 {
     friend class Renderer;
+    friend class Actor;
+    friend class Stage;
 
 public:
     /// \~chinese
@@ -201,9 +203,13 @@ public:
     /// @brief 渲染上下文状态
     struct Status
     {
-        uint32_t primitives;  ///< 渲染图元数量
-        Time     start;       ///< 渲染起始时间
-        Duration duration;    ///< 渲染时长
+        uint32_t primitives;           ///< 渲染图元数量
+        uint32_t drawn_actors;         ///< 渲染的角色数量
+        uint32_t culled_actors;        ///< 被遮挡剔除的角色数量
+        uint32_t static_cache_hits;    ///< 静态缓存命中次数
+        uint32_t static_cache_misses;  ///< 静态缓存未命中次数
+        Time     start;                ///< 渲染起始时间
+        Duration duration;             ///< 渲染时长
 
         Status();
     };
@@ -212,6 +218,10 @@ public:
     /// @brief 启用或禁用状态收集功能
     void SetCollectingStatus(bool enable);
 
+    /// \~chinese
+    /// @brief 是否启用了状态收集功能
+    bool IsCollectingStatus() const;
+
     /// \~chinese
     /// @brief 获取渲染上下文状态
     Status const& GetStatus() const;
@@ -236,6 +246,26 @@ private:
     /// @brief 增加渲染图元数量
     void IncreasePrimitivesCount(uint32_t increase = 1) const;
 
+    /// \~chinese
+    /// @brief 增加渲染的角色数量
+    void IncreaseDrawnActorsCount() const;
+
+    /// \~chinese
+    /// @brief 增加被遮挡剔除的角色数量
+    void IncreaseCulledActorsCount() const;
+
+    /// \~chinese
+    /// @brief 增加静态缓存命中次数
+    void IncreaseStaticCacheHitsCount() const;
+
+    /// \~chinese
+    /// @brief 增加静态缓存未命中次数
+    void IncreaseStaticCacheMissesCount() const;
+
+    /// \~chinese
+    /// @brief 累加离屏上下文收集的状态，不包括渲染时长
+    void MergeStatus(Status const& status) const;
+
     /// \~chinese
     /// @brief 保存绘制状态
     void SaveDrawingState();
@@ -293,7 +323,16 @@ private:
 
 inline RenderContext::Status::Status()
     : primitives(0)
+    , drawn_actors(0)
+    , culled_actors(0)
+    , static_cache_hits(0)
+    , static_cache_misses(0)
+{
+}
+
+inline bool RenderContext::IsCollectingStatus() const
 {
+    return collecting_status_;
 }
 
 inline RenderContext::Status const& RenderContext::GetStatus() const
@@ -26,6 +26,31 @@
 
 namespace kiwano
 {
+namespace
+{
+
+// Textures are always converted to premultiplied BGRA, so opacity comes from the source format
+bool IsOpaqueSource(IWICImagingFactory* factory, ComPtr<IWICBitmapFrameDecode> source)
+{
+    WICPixelFormatGUID format;
+    if (FAILED(source->GetPixelFormat(&format)))
+        return false;
+
+    ComPtr<IWICComponentInfo> info;
+    if (FAILED(factory->CreateComponentInfo(format, &info)))
+        return false;
+
+    ComPtr<IWICPixelFormatInfo2> pixel_info;
+    if (FAILED(info->QueryInterface(&pixel_info)))
+        return false;
+
+    BOOL transparency = TRUE;
+    if (FAILED(pixel_info->SupportsTransparency(&transparency)))
+        return false;
+    return !transparency;
+}
+
+}  // namespace
 
 Renderer::Renderer()
     : target_window_(nullptr)
@@ -166,7 +191,7 @@ void Renderer::HandleEvent(Event* evt)
 {
     if (evt->IsType<WindowResizedEvent>())
     {
-        auto window_evt = dynamic_cast<WindowResizedEvent*>(evt);
+        auto window_evt = evt->SafeCast<WindowResizedEvent>();
         ResizeTarget(window_evt->width, window_evt->height);
     }
 }
@@ -230,6 +255,7 @@ void Renderer::CreateTexture(Texture& texture, String const& file_path)
                     if (SUCCEEDED(hr))
                     {
                         texture.SetBitmap(bitmap);
+                        texture.SetOpaque(IsOpaqueSource(d2d_res_->GetWICImagingFactory(), source));
                     }
                 }
             }
@@ -275,6 +301,7 @@ void Renderer::CreateTexture(Texture& texture, Resource const& resource)
                     if (SUCCEEDED(hr))
                     {
                         texture.SetBitmap(bitmap);
+                        texture.SetOpaque(IsOpaqueSource(d2d_res_->GetWICImagingFactory(), source));
                     }
                 }
             }
@@ -749,7 +776,7 @@ void Renderer::CreateShapeSink(ShapeSink& sink)
     win32::ThrowIfFailed(hr);
 }
 
-void Renderer::CreateTextureRenderTarget(TextureRenderContextPtr& render_context)
+void Renderer::CreateTextureRenderTarget(TextureRenderContextPtr& render_context, const Size* desired_size)
 {
     HRESULT hr = S_OK;
     if (!d2d_res_)
@@ -761,7 +788,15 @@ void Renderer::CreateTextureRenderTarget(TextureRenderContextPtr& render_context
     if (SUCCEEDED(hr))
     {
         ComPtr<ID2D1BitmapRenderTarget> bitmap_rt;
-        hr = d2d_res_->GetDeviceContext()->CreateCompatibleRenderTarget(&bitmap_rt);
+        if (desired_size)
+        {
+            hr = d2d_res_->GetDeviceContext()->CreateCompatibleRenderTarget(DX::ConvertToSizeF(*desired_size),
+                                                                             &bitmap_rt);
+        }
+        else
+        {
+            hr = d2d_res_->GetDeviceContext()->CreateCompatibleRenderTarget(&bitmap_rt);
+        }
 
         if (SUCCEEDED(hr))
         {
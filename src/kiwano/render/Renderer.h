@@ -75,6 +75,10 @@ public:
     /// @brief 开启或关闭垂直同步
     void SetVSyncEnabled(bool enabled);
 
+    /// \~chinese
+    /// @brief 是否开启了垂直同步
+    bool IsVSyncEnabled() const;
+
     /// \~chinese
     /// @brief 设置DPI
     void SetDpi(float dpi);
@@ -167,7 +171,8 @@ public:
     /// \~chinese
     /// @brief 创建纹理渲染上下文
     /// @param[out] render_context 渲染上下文
-    void CreateTextureRenderTarget(TextureRenderContextPtr& render_context);
+    /// @param[in] desired_size 期望的输出大小，为空时与窗口大小相同
+    void CreateTextureRenderTarget(TextureRenderContextPtr& render_context, const Size* desired_size = nullptr);
 
     /// \~chinese
     /// @brief 创建纯色画刷
@@ -277,6 +282,11 @@ inline Size const& Renderer::GetOutputSize() const
     return output_size_;
 }
 
+inline bool Renderer::IsVSyncEnabled() const
+{
+    return vsync_;
+}
+
 inline Color const& Renderer::GetClearColor() const
 {
     return clear_color_;
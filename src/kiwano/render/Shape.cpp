@@ -77,9 +77,19 @@ bool Shape::ComputePointAtLength(float length, Point& point, Vec2& tangent) cons
     return false;
 }
 
+FlattenedPathPtr Shape::GetFlattenedPath() const
+{
+    if (!flattened_ && geo_)
+    {
+        flattened_ = FlattenedPath::Create(*this);
+    }
+    return flattened_;
+}
+
 void Shape::Clear()
 {
     geo_.reset();
+    flattened_.reset();
 }
 
 float Shape::ComputeArea() const
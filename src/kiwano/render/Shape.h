@@ -21,6 +21,7 @@
 #pragma once
 #include <kiwano/core/ObjectBase.h>
 #include <kiwano/render/DirectX/D2DDeviceResources.h>
+#include <kiwano/render/FlattenedPath.h>
 
 namespace kiwano
 {
@@ -44,6 +45,7 @@ class KGE_API Shape : public virtual ObjectBase
     friend class RenderContext;
     friend class Renderer;
     friend class ShapeSink;
+    friend class FlattenedPath;
 
 public:
     /// \~chinese
@@ -111,6 +113,11 @@ public:
     /// @param[out] tangent 点的切线向量
     bool ComputePointAtLength(float length, Point& point, Vec2& tangent) const;
 
+    /// \~chinese
+    /// @brief 获取展平路径
+    /// @details 展平路径在首次调用时生成，之后被所有使用该形状的对象共享，形状改变后会重新生成
+    FlattenedPathPtr GetFlattenedPath() const;
+
     /// \~chinese
     /// @brief 清除形状
     void Clear();
@@ -121,7 +128,8 @@ private:
     void SetGeometry(ComPtr<ID2D1Geometry> shape);
 
 private:
-    ComPtr<ID2D1Geometry> geo_;
+    ComPtr<ID2D1Geometry>    geo_;
+    mutable FlattenedPathPtr flattened_;
 };
 
 /** @} */
@@ -134,6 +142,7 @@ inline ComPtr<ID2D1Geometry> Shape::GetGeometry() const
 inline void Shape::SetGeometry(ComPtr<ID2D1Geometry> shape)
 {
     geo_ = shape;
+    flattened_.reset();
 }
 
 }  // namespace kiwano
@@ -60,6 +60,13 @@ void TextLayout::Update()
     dirty_flag_ = DirtyFlag::Updated;
 }
 
+void TextLayout::Discard()
+{
+    text_format_.reset();
+    text_layout_.reset();
+    dirty_flag_ |= DirtyFlag::DirtyFormat | DirtyFlag::DirtyLayout;
+}
+
 void TextLayout::SetText(const String& text)
 {
     text_ = text;
@@ -57,6 +57,11 @@ public:
     /// @note 文本布局是懒更新的，在修改文本布局的属性后需要手动更新
     void Update();
 
+    /// \~chinese
+    /// @brief 释放文字格式和文字布局，下次更新时重新创建
+    /// @note 单独设置的下划线和删除线区域不会被保留
+    void Discard();
+
     /// \~chinese
     /// @brief 获取文本
     const String& GetText() const;
@@ -49,7 +49,8 @@ TexturePtr Texture::Create(Resource const& res)
 }
 
 Texture::Texture()
-    : interpolation_mode_(default_interpolation_mode_)
+    : opaque_(false)
+    , interpolation_mode_(default_interpolation_mode_)
 {
 }
 
@@ -140,6 +141,7 @@ void Texture::CopyFrom(TexturePtr copy_from)
         HRESULT hr = bitmap_->CopyFromBitmap(nullptr, copy_from->GetBitmap().get(), nullptr);
 
         win32::ThrowIfFailed(hr);
+        opaque_ = copy_from->IsOpaque();
     }
 }
 
@@ -153,6 +155,7 @@ void Texture::CopyFrom(TexturePtr copy_from, Rect const& src_rect, Point const&
                          uint32_t(src_rect.GetBottom())));
 
         win32::ThrowIfFailed(hr);
+        opaque_ = opaque_ && copy_from->IsOpaque();
     }
 }
 
@@ -187,6 +190,7 @@ ComPtr<ID2D1Bitmap> Texture::GetBitmap() const
 void Texture::SetBitmap(ComPtr<ID2D1Bitmap> bitmap)
 {
     bitmap_ = bitmap;
+    opaque_ = false;
 }
 
 void Texture::SetDefaultInterpolationMode(InterpolationMode mode)
@@ -114,6 +114,17 @@ public:
     /// @brief 获取像素格式
     D2D1_PIXEL_FORMAT GetPixelFormat() const;
 
+    /// \~chinese
+    /// @brief 纹理是否完全不透明
+    /// @details 纹理统一以预乘透明度格式存储，因此不透明属性在解码时根据源图片格式记录，
+    /// 源图片不含透明通道时为 true
+    bool IsOpaque() const;
+
+    /// \~chinese
+    /// @brief 设置纹理是否完全不透明
+    /// @details 用于标记不含透明像素但以带透明通道格式存储的图片，错误的标记会导致遮挡剔除出错
+    void SetOpaque(bool opaque);
+
     /// \~chinese
     /// @brief 拷贝纹理
     /// @param copy_from 源纹理
@@ -148,6 +159,7 @@ private:
     void SetBitmap(ComPtr<ID2D1Bitmap> bitmap);
 
 private:
+    bool                opaque_;
     ComPtr<ID2D1Bitmap> bitmap_;
     InterpolationMode   interpolation_mode_;
 
@@ -155,4 +167,14 @@ private:
 };
 
 /** @} */
+
+inline bool Texture::IsOpaque() const
+{
+    return opaque_;
+}
+
+inline void Texture::SetOpaque(bool opaque)
+{
+    opaque_ = opaque;
+}
 }  // namespace kiwano
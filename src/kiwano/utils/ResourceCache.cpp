@@ -19,6 +19,7 @@
 // THE SOFTWARE.
 
 #include <fstream>
+#include <kiwano/2d/action/AnimationClip.h>
 #include <kiwano/core/Logger.h>
 #include <kiwano/platform/FileSystem.h>
 #include <kiwano/utils/ResourceCache.h>
@@ -297,6 +298,19 @@ ObjectBasePtr ResourceCache::Get(String const& id) const
     return (*iter).second;
 }
 
+String ResourceCache::FindId(ObjectBase* obj) const
+{
+    if (obj)
+    {
+        for (const auto& pair : object_cache_)
+        {
+            if (pair.second.get() == obj)
+                return pair.first;
+        }
+    }
+    return String();
+}
+
 }  // namespace kiwano
 
 namespace kiwano
@@ -414,6 +428,27 @@ bool LoadFontsFromData(ResourceCache* loader, GlobalData* gdata, const String* i
     return false;
 }
 
+bool LoadClipsFromData(ResourceCache* loader, GlobalData* gdata, const String* id, const String* file,
+                       const String* frames, Json const* clip_data)
+{
+    if (!gdata || !id)
+        return false;
+
+    AnimationClipPtr clip;
+    if (file)
+        clip = AnimationClip::Load(gdata->path + (*file));
+    else if (clip_data)
+        clip = AnimationClip::Load(*clip_data);
+
+    if (clip)
+    {
+        if (frames)
+            clip->SetFrameSequence(loader->Get<FrameSequence>(*frames));
+        return loader->AddObject(*id, clip);
+    }
+    return false;
+}
+
 bool LoadJsonData(ResourceCache* loader, Json const& json_data)
 {
     GlobalData global_data;
@@ -486,6 +521,24 @@ bool LoadJsonData(ResourceCache* loader, Json const& json_data)
                 return false;
         }
     }
+
+    if (json_data.count(L"clips"))
+    {
+        for (const auto& clip : json_data[L"clips"])
+        {
+            const String *id = nullptr, *file = nullptr, *frames = nullptr;
+
+            if (clip.count(L"id"))
+                id = &clip[L"id"].as_string();
+            if (clip.count(L"file"))
+                file = &clip[L"file"].as_string();
+            if (clip.count(L"frames"))
+                frames = &clip[L"frames"].as_string();
+
+            if (!LoadClipsFromData(loader, &global_data, id, file, frames, &clip))
+                return false;
+        }
+    }
     return true;
 }
 
@@ -72,6 +72,12 @@ public:
         return dynamic_cast<_Ty*>(Get(id).get());
     }
 
+    /// \~chinese
+    /// @brief 查找资源对应的ID
+    /// @param obj 对象
+    /// @return 对象ID，对象不在缓存中时返回空字符串
+    String FindId(ObjectBase* obj) const;
+
     /// \~chinese
     /// @brief 将对象放入缓存
     /// @param id 对象ID
@@ -0,0 +1,788 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <fstream>
+#include <typeinfo>
+#include <kiwano/2d/Sprite.h>
+#include <kiwano/2d/action/ActionDelay.h>
+#include <kiwano/2d/action/ActionGroup.h>
+#include <kiwano/2d/action/ActionTween.h>
+#include <kiwano/core/Logger.h>
+#include <kiwano/platform/FileSystem.h>
+#include <kiwano/utils/ResourceCache.h>
+#include <kiwano/utils/SceneFile.h>
+
+namespace kiwano
+{
+namespace
+{
+const char     scene_file_magic[4] = { 'K', 'G', 'S', 'C' };
+const uint32_t scene_file_version  = 2;
+const uint32_t invalid_index       = uint32_t(-1);
+
+enum class NodeType : uint8_t
+{
+    Actor,
+    Stage,
+    Sprite,
+};
+
+enum NodeFlag : uint8_t
+{
+    NodeVisible        = 1,
+    NodeCascadeOpacity = 1 << 1,
+    NodeResponsible    = 1 << 2,
+};
+
+enum class ActionType : uint8_t
+{
+    Unknown,
+    Delay,
+    Group,
+    MoveBy,
+    MoveTo,
+    ScaleBy,
+    ScaleTo,
+    RotateBy,
+    RotateTo,
+    FadeTo,
+};
+
+#pragma pack(push, 4)
+
+struct FileHeader
+{
+    char     magic[4];
+    uint32_t version;
+    uint32_t node_count;
+    uint32_t action_count;
+    uint32_t string_count;
+    uint32_t char_count;
+};
+
+struct NodeRecord
+{
+    NodeType type;
+    uint8_t  flags;
+    uint16_t reserved;
+    int32_t  parent;  // 父节点记录下标，-1 表示根节点
+    int32_t  z_order;
+    uint32_t name;
+    uint32_t resource;
+    uint32_t action_count;
+    float    position[2];
+    float    scale[2];
+    float    skew[2];
+    float    anchor[2];
+    float    size[2];
+    float    rotation;
+    float    opacity;
+};
+
+struct ActionRecord
+{
+    ActionType type;
+    uint8_t    sync;
+    uint8_t    ease;        // EaseType，自定义缓动函数保存为线性
+    uint8_t    ease_table;  // 是否启用缓动查找表
+    int32_t    loops;
+    int32_t    duration;  // 毫秒
+    int32_t    delay;     // 毫秒
+    uint32_t   name;
+    uint32_t   child_count;
+    float      params[2];
+    float      ease_param;
+};
+
+struct StringRecord
+{
+    uint32_t offset;
+    uint32_t length;
+};
+
+#pragma pack(pop)
+
+class SceneWriterImpl
+{
+public:
+    explicit SceneWriterImpl(bool children_only)
+        : children_only_(children_only)
+    {
+    }
+
+    bool Write(Stage* stage, String const& file_path)
+    {
+        if (!WriteNode(stage, -1))
+            return false;
+
+        FileHeader header;
+        ::memcpy(header.magic, scene_file_magic, sizeof(header.magic));
+        header.version      = scene_file_version;
+        header.node_count   = uint32_t(nodes_.size());
+        header.action_count = uint32_t(actions_.size());
+        header.string_count = uint32_t(strings_.size());
+        header.char_count   = uint32_t(chars_.size());
+
+        std::ofstream ofs(file_path.c_str(), std::ios::binary | std::ios::trunc);
+        if (!ofs)
+        {
+            KGE_ERROR(L"SceneWriter::Save failed: Cannot open file %s", file_path.c_str());
+            return false;
+        }
+
+        ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        WriteArray(ofs, nodes_);
+        WriteArray(ofs, actions_);
+        WriteArray(ofs, strings_);
+        WriteArray(ofs, chars_);
+        return ofs.good();
+    }
+
+private:
+    template <typename _Ty>
+    void WriteArray(std::ofstream& ofs, Vector<_Ty> const& arr)
+    {
+        if (!arr.empty())
+            ofs.write(reinterpret_cast<const char*>(&arr[0]), arr.size_in_bytes());
+    }
+
+    bool WriteNode(Actor* actor, int32_t parent)
+    {
+        NodeRecord record = {};
+        record.type       = NodeType::Actor;
+        record.parent     = parent;
+        record.z_order    = actor->GetZOrder();
+        record.name       = AddString(actor->GetName());
+        record.resource   = invalid_index;
+
+        if (actor->IsVisible())
+            record.flags |= NodeVisible;
+        if (actor->IsCascadeOpacityEnabled())
+            record.flags |= NodeCascadeOpacity;
+        if (actor->IsResponsible())
+            record.flags |= NodeResponsible;
+
+        record.position[0] = actor->GetPositionX();
+        record.position[1] = actor->GetPositionY();
+        record.scale[0]    = actor->GetScaleX();
+        record.scale[1]    = actor->GetScaleY();
+        record.skew[0]     = actor->GetSkewX();
+        record.skew[1]     = actor->GetSkewY();
+        record.anchor[0]   = actor->GetAnchorX();
+        record.anchor[1]   = actor->GetAnchorY();
+        record.size[0]     = actor->GetWidth();
+        record.size[1]     = actor->GetHeight();
+        record.rotation    = actor->GetRotation();
+        record.opacity     = actor->GetOpacity();
+
+        // 只接受类型完全匹配的节点，派生类的状态无法还原
+        if (parent < 0)
+        {
+            record.type = NodeType::Stage;
+        }
+        else if (typeid(*actor) == typeid(Sprite))
+        {
+            record.type     = NodeType::Sprite;
+            record.resource = AddResource(static_cast<Sprite*>(actor)->GetFrame().get());
+        }
+        else if (typeid(*actor) != typeid(Actor))
+        {
+            KGE_ERROR(L"SceneWriter::Save failed: Actor type %S is not serializable", typeid(*actor).name());
+            return false;
+        }
+
+        // 舞台本身不会被恢复，但子节点的任何状态都不能丢失
+        if (children_only_ && parent >= 0 && !CheckLossless(actor, record))
+            return false;
+
+        if (!children_only_)
+        {
+            // Action hides its list links, iterate the lists instead
+            for (auto& action : actor->GetAllActions())
+            {
+                if (WriteAction(&action))
+                    ++record.action_count;
+            }
+        }
+
+        // 先序存储，父节点总在子节点之前，子节点已按 Z 轴顺序排列
+        const int32_t index = int32_t(nodes_.size());
+        nodes_.push_back(record);
+
+        for (auto child = actor->GetAllChildren().first_item(); child; child = child->next_item())
+        {
+            if (!WriteNode(child.get(), index))
+                return false;
+        }
+        return true;
+    }
+
+    bool CheckLossless(Actor* actor, NodeRecord const& record)
+    {
+        const wchar_t* reason = nullptr;
+        if (!actor->GetAllActions().empty())
+            reason = L"progress of actions";
+        else if (!actor->GetAllListeners().empty())
+            reason = L"event listeners";
+        else if (!actor->GetAllTimers().empty())
+            reason = L"timers";
+#ifdef KGE_HAS_COROUTINE
+        else if (actor->GetTasksCount() != 0)
+            reason = L"coroutine tasks";
+#endif
+        else if (actor->GetCallbackOnUpdate())
+            reason = L"update callback";
+        else if (actor->GetUserData().has_value())
+            reason = L"user data";
+        else if (actor->IsStatic() || actor->IsUpdatePausing())
+            reason = L"static or paused state";
+        else if (record.type == NodeType::Sprite && record.resource == invalid_index
+                 && static_cast<Sprite*>(actor)->GetFrame())
+            reason = L"frame that is not in ResourceCache";
+
+        if (reason)
+        {
+            KGE_ERROR(L"SceneWriter::SaveChildren failed: Actor '%s' has %s, which cannot be saved",
+                      actor->GetName().c_str(), reason);
+            return false;
+        }
+        return true;
+    }
+
+    bool WriteAction(Action* action)
+    {
+        ActionRecord record = {};
+        record.type         = ActionType::Unknown;
+        record.loops        = action->GetLoops();
+        record.delay        = int32_t(action->GetDelay().Milliseconds());
+        record.name         = AddString(action->GetName());
+
+        if (auto tween = dynamic_cast<ActionTween*>(action))
+        {
+            EaseCurve const& curve = tween->GetEaseCurve();
+
+            record.duration = int32_t(tween->GetDuration().Milliseconds());
+            record.ease     = uint8_t(EaseType::Linear);
+            if (curve.type == EaseType::Custom)
+            {
+                KGE_WARN(L"SceneWriter: custom ease function of action is not serializable and will be ignored");
+            }
+            else
+            {
+                record.ease       = uint8_t(curve.type);
+                record.ease_table = curve.table ? 1 : 0;
+                record.ease_param = curve.param;
+            }
+        }
+
+        // 按派生顺序检查，子类必须先于父类
+        if (auto move_to = dynamic_cast<ActionMoveTo*>(action))
+        {
+            record.type = ActionType::MoveTo;
+            SetParams(record, move_to->GetTargetPos());
+        }
+        else if (auto move_by = dynamic_cast<ActionMoveBy*>(action))
+        {
+            record.type = ActionType::MoveBy;
+            SetParams(record, move_by->GetVector());
+        }
+        else if (auto scale_to = dynamic_cast<ActionScaleTo*>(action))
+        {
+            record.type = ActionType::ScaleTo;
+            SetParams(record, scale_to->GetTargetScale());
+        }
+        else if (auto scale_by = dynamic_cast<ActionScaleBy*>(action))
+        {
+            record.type = ActionType::ScaleBy;
+            SetParams(record, scale_by->GetScaleDelta());
+        }
+        else if (auto rotate_to = dynamic_cast<ActionRotateTo*>(action))
+        {
+            record.type      = ActionType::RotateTo;
+            record.params[0] = rotate_to->GetTargetRotation();
+        }
+        else if (auto rotate_by = dynamic_cast<ActionRotateBy*>(action))
+        {
+            record.type      = ActionType::RotateBy;
+            record.params[0] = rotate_by->GetRotationDelta();
+        }
+        else if (auto fade_to = dynamic_cast<ActionFadeTo*>(action))
+        {
+            record.type      = ActionType::FadeTo;
+            record.params[0] = fade_to->GetTargetOpacity();
+        }
+        else if (dynamic_cast<ActionDelay*>(action))
+        {
+            record.type = ActionType::Delay;
+        }
+        else if (auto group = dynamic_cast<ActionGroup*>(action))
+        {
+            record.type = ActionType::Group;
+            record.sync = group->IsSyncMode() ? 1 : 0;
+
+            // 组合动画的子动画紧随其后存储
+            const size_t index = actions_.size();
+            actions_.push_back(record);
+
+            uint32_t child_count = 0;
+            for (auto& child : group->GetActions())
+            {
+                if (WriteAction(&child))
+                    ++child_count;
+            }
+            actions_[index].child_count = child_count;
+            return true;
+        }
+
+        if (record.type == ActionType::Unknown)
+        {
+            KGE_WARN(L"SceneWriter: unsupported action type will be ignored");
+            return false;
+        }
+
+        actions_.push_back(record);
+        return true;
+    }
+
+    void SetParams(ActionRecord& record, Vec2 const& vec)
+    {
+        record.params[0] = vec.x;
+        record.params[1] = vec.y;
+    }
+
+    uint32_t AddResource(Frame* frame)
+    {
+        if (!frame)
+            return invalid_index;
+
+        auto iter = resources_.find(frame);
+        if (iter != resources_.end())
+            return iter->second;
+
+        String id = ResourceCache::Instance().FindId(frame);
+        if (id.empty())
+        {
+            KGE_WARN(L"SceneWriter: frame of sprite is not in ResourceCache, the reference will be lost");
+        }
+
+        uint32_t index    = id.empty() ? invalid_index : AddString(id);
+        resources_[frame] = index;
+        return index;
+    }
+
+    uint32_t AddString(String const& str)
+    {
+        if (str.empty())
+            return invalid_index;
+
+        auto iter = string_indices_.find(str);
+        if (iter != string_indices_.end())
+            return iter->second;
+
+        StringRecord record;
+        record.offset = uint32_t(chars_.size());
+        record.length = uint32_t(str.size());
+        for (auto ch : str)
+            chars_.push_back(ch);
+
+        uint32_t index       = uint32_t(strings_.size());
+        string_indices_[str] = index;
+        strings_.push_back(record);
+        return index;
+    }
+
+private:
+    bool                           children_only_;
+    Vector<NodeRecord>             nodes_;
+    Vector<ActionRecord>           actions_;
+    Vector<StringRecord>           strings_;
+    Vector<wchar_t>                chars_;
+    Map<String, uint32_t>          string_indices_;
+    UnorderedMap<Frame*, uint32_t> resources_;
+};
+
+class MappedFile
+{
+public:
+    MappedFile()
+        : file_(INVALID_HANDLE_VALUE)
+        , mapping_(nullptr)
+        , data_(nullptr)
+        , size_(0)
+    {
+    }
+
+    ~MappedFile()
+    {
+        if (data_)
+            ::UnmapViewOfFile(data_);
+        if (mapping_)
+            ::CloseHandle(mapping_);
+        if (file_ != INVALID_HANDLE_VALUE)
+            ::CloseHandle(file_);
+    }
+
+    bool Open(String const& file_path)
+    {
+        file_ = ::CreateFileW(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER file_size;
+        if (!::GetFileSizeEx(file_, &file_size) || file_size.QuadPart == 0 || file_size.HighPart != 0)
+            return false;
+
+        mapping_ = ::CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping_)
+            return false;
+
+        data_ = static_cast<const uint8_t*>(::MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        size_ = size_t(file_size.QuadPart);
+        return data_ != nullptr;
+    }
+
+    const uint8_t* GetData() const
+    {
+        return data_;
+    }
+
+    size_t GetSize() const
+    {
+        return size_;
+    }
+
+private:
+    HANDLE         file_;
+    HANDLE         mapping_;
+    const uint8_t* data_;
+    size_t         size_;
+};
+
+class SceneLoaderImpl
+{
+public:
+    bool Load(Stage* stage, const uint8_t* data, size_t size, bool children_only)
+    {
+        if (size < sizeof(FileHeader))
+            return false;
+
+        const FileHeader* header = reinterpret_cast<const FileHeader*>(data);
+        if (::memcmp(header->magic, scene_file_magic, sizeof(header->magic)) != 0)
+        {
+            KGE_ERROR(L"SceneLoader::Load failed: Invalid scene file");
+            return false;
+        }
+
+        if (header->version != scene_file_version)
+        {
+            KGE_ERROR(L"SceneLoader::Load failed: Unsupported scene file version %u", header->version);
+            return false;
+        }
+
+        const uint64_t expected_size = uint64_t(sizeof(FileHeader)) + uint64_t(header->node_count) * sizeof(NodeRecord)
+                                       + uint64_t(header->action_count) * sizeof(ActionRecord)
+                                       + uint64_t(header->string_count) * sizeof(StringRecord)
+                                       + uint64_t(header->char_count) * sizeof(wchar_t);
+        if (expected_size > size || header->node_count == 0)
+        {
+            KGE_ERROR(L"SceneLoader::Load failed: Scene file is corrupted");
+            return false;
+        }
+
+        nodes_        = reinterpret_cast<const NodeRecord*>(header + 1);
+        actions_      = reinterpret_cast<const ActionRecord*>(nodes_ + header->node_count);
+        strings_      = reinterpret_cast<const StringRecord*>(actions_ + header->action_count);
+        chars_        = reinterpret_cast<const wchar_t*>(strings_ + header->string_count);
+        action_count_ = header->action_count;
+        string_count_ = header->string_count;
+        char_count_   = header->char_count;
+        next_action_  = 0;
+
+        if (nodes_[0].parent >= 0)
+            return false;
+
+        // 舞台的动画先读出，全部节点创建成功后再应用
+        Vector<ActionPtr> stage_actions;
+        if (!ReadActions(nodes_[0], stage_actions))
+            return false;
+
+        // 新节点先挂在脱离舞台的子树上，加载失败时舞台保持原样
+        Vector<ActorPtr> top_level;
+        Vector<Actor*>   actors;
+        actors.reserve(header->node_count);
+        actors.push_back(nullptr);
+        for (uint32_t i = 1; i < header->node_count; ++i)
+        {
+            const NodeRecord& record = nodes_[i];
+
+            // 先序存储保证父节点已创建
+            if (record.parent < 0 || uint32_t(record.parent) >= i)
+                return false;
+
+            ActorPtr actor = CreateActor(record);
+            if (!actor)
+                return false;
+
+            ApplyNode(actor.get(), record, true);
+
+            Vector<ActionPtr> node_actions;
+            if (!ReadActions(record, node_actions))
+                return false;
+            for (auto& action : node_actions)
+                actor->AddAction(action);
+
+            if (record.parent == 0)
+            {
+                actor->SetZOrder(record.z_order);
+                top_level.push_back(actor);
+            }
+            else
+            {
+                actors[record.parent]->AddChild(actor, record.z_order);
+            }
+            actors.push_back(actor.get());
+        }
+
+        // 只加载子节点时，舞台保留原有的属性和动画
+        if (!children_only)
+        {
+            ApplyNode(stage, nodes_[0], false);
+            for (auto& action : stage_actions)
+                stage->AddAction(action);
+        }
+
+        for (auto& actor : top_level)
+            stage->AddChild(actor, actor->GetZOrder());
+        return true;
+    }
+
+private:
+    ActorPtr CreateActor(NodeRecord const& record)
+    {
+        if (record.type == NodeType::Sprite)
+        {
+            SpritePtr sprite = new (std::nothrow) Sprite;
+            if (sprite && record.resource != invalid_index)
+            {
+                FramePtr frame = ResourceCache::Instance().Get<Frame>(GetString(record.resource));
+                if (frame)
+                    sprite->SetFrame(frame);
+                else
+                    KGE_WARN(L"SceneLoader: frame '%s' not found in ResourceCache", GetString(record.resource).c_str());
+            }
+            return sprite;
+        }
+        return new (std::nothrow) Actor;
+    }
+
+    void ApplyNode(Actor* actor, NodeRecord const& record, bool apply_size)
+    {
+        actor->SetName(GetString(record.name));
+        actor->SetVisible((record.flags & NodeVisible) != 0);
+        actor->SetCascadeOpacityEnabled((record.flags & NodeCascadeOpacity) != 0);
+        actor->SetResponsible((record.flags & NodeResponsible) != 0);
+        actor->SetAnchor(record.anchor[0], record.anchor[1]);
+        if (apply_size)
+            actor->SetSize(record.size[0], record.size[1]);
+        actor->SetPosition(record.position[0], record.position[1]);
+        actor->SetScale(record.scale[0], record.scale[1]);
+        actor->SetSkew(record.skew[0], record.skew[1]);
+        actor->SetRotation(record.rotation);
+        actor->SetOpacity(record.opacity);
+    }
+
+    bool ReadActions(NodeRecord const& record, Vector<ActionPtr>& actions)
+    {
+        actions.reserve(record.action_count);
+        for (uint32_t i = 0; i < record.action_count; ++i)
+        {
+            ActionPtr action = ReadAction();
+            if (!action)
+                return false;
+            actions.push_back(action);
+        }
+        return true;
+    }
+
+    ActionPtr ReadAction()
+    {
+        if (next_action_ >= action_count_)
+            return nullptr;
+
+        const ActionRecord& record = actions_[next_action_++];
+        const Duration      dur    = record.duration * Duration::Ms;
+
+        ActionPtr action;
+        switch (record.type)
+        {
+        case ActionType::Delay:
+            action = new (std::nothrow) ActionDelay(record.delay * Duration::Ms);
+            break;
+        case ActionType::MoveBy:
+            action = new (std::nothrow) ActionMoveBy(dur, Vec2(record.params[0], record.params[1]));
+            break;
+        case ActionType::MoveTo:
+            action = new (std::nothrow) ActionMoveTo(dur, Point(record.params[0], record.params[1]));
+            break;
+        case ActionType::ScaleBy:
+            action = new (std::nothrow) ActionScaleBy(dur, record.params[0], record.params[1]);
+            break;
+        case ActionType::ScaleTo:
+            action = new (std::nothrow) ActionScaleTo(dur, record.params[0], record.params[1]);
+            break;
+        case ActionType::RotateBy:
+            action = new (std::nothrow) ActionRotateBy(dur, record.params[0]);
+            break;
+        case ActionType::RotateTo:
+            action = new (std::nothrow) ActionRotateTo(dur, record.params[0]);
+            break;
+        case ActionType::FadeTo:
+            action = new (std::nothrow) ActionFadeTo(dur, record.params[0]);
+            break;
+        case ActionType::Group:
+        {
+            Vector<ActionPtr> children;
+            children.reserve(record.child_count);
+            for (uint32_t i = 0; i < record.child_count; ++i)
+            {
+                ActionPtr child = ReadAction();
+                if (!child)
+                    return nullptr;
+                children.push_back(child);
+            }
+            action = new (std::nothrow) ActionGroup(children, record.sync != 0);
+            break;
+        }
+        default:
+            return nullptr;
+        }
+
+        if (action)
+        {
+            if (auto tween = dynamic_cast<ActionTween*>(action.get()))
+            {
+                const EaseType type = EaseType(record.ease);
+                if (type == EaseType::Custom || type > EaseType::SineInOut)
+                    return nullptr;
+
+                if (type != EaseType::Linear)
+                {
+                    EaseCurve curve(type, record.ease_param);
+                    if (record.ease_table && curve.IsLookupTableSupported())
+                        curve.UseLookupTable();
+                    tween->SetEaseCurve(curve);
+                }
+            }
+
+            action->SetName(GetString(record.name));
+            action->SetLoops(record.loops);
+            action->SetDelay(record.delay * Duration::Ms);
+        }
+        return action;
+    }
+
+    String GetString(uint32_t index) const
+    {
+        if (index >= string_count_)
+            return String();
+
+        const StringRecord& record = strings_[index];
+        if (uint64_t(record.offset) + record.length > char_count_)
+            return String();
+        return String(chars_ + record.offset, record.length);
+    }
+
+private:
+    const NodeRecord*   nodes_        = nullptr;
+    const ActionRecord* actions_      = nullptr;
+    const StringRecord* strings_      = nullptr;
+    const wchar_t*      chars_        = nullptr;
+    uint32_t            action_count_ = 0;
+    uint32_t            string_count_ = 0;
+    uint32_t            char_count_   = 0;
+    uint32_t            next_action_  = 0;
+};
+}  // namespace
+
+bool SceneWriter::Save(Stage* stage, String const& file_path)
+{
+    if (!stage)
+        return false;
+
+    SceneWriterImpl writer(false);
+    return writer.Write(stage, file_path);
+}
+
+bool SceneWriter::SaveChildren(Stage* stage, String const& file_path)
+{
+    if (!stage)
+        return false;
+
+    SceneWriterImpl writer(true);
+    return writer.Write(stage, file_path);
+}
+
+StagePtr SceneLoader::Load(String const& file_path)
+{
+    StagePtr ptr = new (std::nothrow) Stage;
+    if (ptr)
+    {
+        if (!Load(ptr.get(), file_path))
+            return nullptr;
+    }
+    return ptr;
+}
+
+bool SceneLoader::Load(Stage* stage, String const& file_path)
+{
+    return LoadFile(stage, file_path, false);
+}
+
+bool SceneLoader::LoadChildren(Stage* stage, String const& file_path)
+{
+    return LoadFile(stage, file_path, true);
+}
+
+bool SceneLoader::LoadFile(Stage* stage, String const& file_path, bool children_only)
+{
+    if (!stage)
+        return false;
+
+    String full_path = FileSystem::Instance().GetFullPathForFile(file_path);
+    if (full_path.empty())
+    {
+        KGE_ERROR(L"SceneLoader::Load failed: File not found.");
+        return false;
+    }
+
+    MappedFile file;
+    if (!file.Open(full_path))
+    {
+        KGE_ERROR(L"SceneLoader::Load failed: Cannot map file %s", full_path.c_str());
+        return false;
+    }
+
+    SceneLoaderImpl loader;
+    return loader.Load(stage, file.GetData(), file.GetSize(), children_only);
+}
+
+}  // namespace kiwano
@@ -0,0 +1,94 @@
+// Copyright (c) 2016-2020 Kiwano - Nomango
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+#include <kiwano/2d/Stage.h>
+
+namespace kiwano
+{
+/**
+ * \addtogroup Actors
+ * @{
+ */
+
+/**
+ * \~chinese
+ * @brief 二进制场景文件写入器
+ * @details 将舞台的角色树（变换、Z轴顺序、名称、资源引用和动画）序列化为紧凑的二进制场景文件
+ * @note 精灵的图像帧需要已存放在 ResourceCache 中才能被引用，动画仅支持常用补间动画、延时动画和动画组合
+ * @note 舞台的子节点只能是 Actor 或 Sprite 类型（不含派生类），遇到其他类型时保存失败
+ */
+class KGE_API SceneWriter
+{
+public:
+    /// \~chinese
+    /// @brief 将舞台保存为二进制场景文件
+    /// @param stage 舞台
+    /// @param file_path 文件路径
+    /// @return 操作是否成功
+    static bool Save(Stage* stage, String const& file_path);
+
+    /// \~chinese
+    /// @brief 只保存舞台的子节点
+    /// @details 用于之后通过 SceneLoader::LoadChildren 恢复到同一个舞台，舞台自身的属性和动画不会被保存。
+    /// 子节点带有动画、监听器、定时器、协程任务、更新回调或用户数据等无法保存的状态时保存失败
+    /// @param stage 舞台
+    /// @param file_path 文件路径
+    /// @return 操作是否成功
+    static bool SaveChildren(Stage* stage, String const& file_path);
+};
+
+/**
+ * \~chinese
+ * @brief 二进制场景文件加载器
+ * @details 通过内存映射读取二进制场景文件，按先序排列的角色记录一次性构建角色树
+ */
+class KGE_API SceneLoader
+{
+public:
+    /// \~chinese
+    /// @brief 从二进制场景文件创建舞台
+    /// @param file_path 文件路径
+    /// @return 舞台，加载失败时返回空指针
+    static StagePtr Load(String const& file_path);
+
+    /// \~chinese
+    /// @brief 从二进制场景文件加载角色到已有舞台
+    /// @details 加载失败时舞台保持不变
+    /// @param stage 舞台
+    /// @param file_path 文件路径
+    /// @return 操作是否成功
+    static bool Load(Stage* stage, String const& file_path);
+
+    /// \~chinese
+    /// @brief 从二进制场景文件加载子节点到已有舞台
+    /// @details 文件中舞台自身的属性和动画会被忽略，加载失败时舞台保持不变
+    /// @param stage 舞台
+    /// @param file_path 文件路径
+    /// @return 操作是否成功
+    static bool LoadChildren(Stage* stage, String const& file_path);
+
+private:
+    static bool LoadFile(Stage* stage, String const& file_path, bool children_only);
+};
+
+/** @} */
+}  // namespace kiwano